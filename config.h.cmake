@@ -88,6 +88,9 @@
 #cmakedefine USE_COCOA 1
 #cmakedefine USE_GTK 1
 
+/* Collect execution time statistics */
+#cmakedefine STAT 1
+
 /* Enable automatic update system */
 #cmakedefine WITH_AUTOMATIC_UPDATE 1
 #cmakedefine WITH_APPDIR_INSTALLATION 1
@@ -0,0 +1,40 @@
+/*
+	Benchmarks
+	Runs all benchmarks one after another, or only the one picked with
+	--scenpar=Benchmark=n. The benchmarks are in System.ocg and call
+	BenchmarkDone() when they are finished.
+*/
+
+static const LOG_LINE_LEN = 50;
+// In the order of the Benchmark scenario parameter. Benchmarks that change the landscape come last.
+static const BENCHMARKS = ["FindObject", "PathFinder", "CrossCheck", "ObjectReference", "MassMover"];
+
+static benchmark_queue;
+
+func Initialize()
+{
+	// Benchmarks over many frames should measure the frames, not the tick delay
+	SetGameSpeed(1000);
+	if (SCENPAR_Benchmark)
+		benchmark_queue = [BENCHMARKS[SCENPAR_Benchmark - 1]];
+	else
+		benchmark_queue = BENCHMARKS[:];
+	Schedule(nil, "StartNextBenchmark()", 1);
+}
+
+global func BenchmarkDone()
+{
+	Schedule(nil, "StartNextBenchmark()", 1);
+}
+
+global func StartNextBenchmark()
+{
+	// Every benchmark starts without the objects of the previous one
+	RemoveAll(Find_Or(Find_ID(Rock), Find_ID(Clonk)));
+	if (!GetLength(benchmark_queue))
+		return Log("Benchmarks done");
+	var name = benchmark_queue[0];
+	benchmark_queue = benchmark_queue[1:];
+	Log("%s benchmark:", name);
+	Call(Format("Benchmark%s", name));
+}
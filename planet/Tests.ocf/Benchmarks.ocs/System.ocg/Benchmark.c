@@ -0,0 +1,26 @@
+// Helpers shared by the benchmarks
+
+// Logs msg padded to len characters, followed by value and unit
+global func FixLenLog(string msg, int value, int len, string unit)
+{
+	len = len ?? 30;
+	unit = unit ?? "";
+	var num_len = 4;
+
+	while (GetLength(msg) < len - num_len)
+		msg = Format("%s_", msg);
+	Log("%s%4d%s", msg, value, unit);
+}
+
+// Returns a random [x, y] position that is not inside solid material
+global func FindFreePoint()
+{
+	var x, y;
+	do
+	{
+		x = Random(LandscapeWidth());
+		y = Random(LandscapeHeight());
+	}
+	while (GBackSolid(x, y));
+	return [x, y];
+}
@@ -0,0 +1,31 @@
+// Many clonks with lots of flying rocks around them
+
+global func BenchmarkCrossCheck()
+{
+	for (var i = 0; i < 200; ++i)
+	{
+		var pos = FindFreePoint();
+		CreateObject(Clonk, pos[0], pos[1]);
+	}
+	var fx = AddEffect("IntCrossCheckRocks", nil, 1, 1);
+	fx.rock_count = 2000;
+	fx.start = GetTime();
+}
+
+global func FxIntCrossCheckRocksTimer(object target, proplist fx, int time)
+{
+	var frame_count = 300;
+	if (time >= frame_count)
+	{
+		FixLenLog(Format("%d frames, %d clonks, %d rocks", frame_count, ObjectCount(Find_ID(Clonk)), fx.rock_count), GetTime() - fx.start, LOG_LINE_LEN, "ms");
+		BenchmarkDone();
+		return FX_Execute_Kill;
+	}
+	// Keep the number of rocks constant
+	for (var i = ObjectCount(Find_ID(Rock)); i < fx.rock_count; ++i)
+	{
+		var pos = FindFreePoint();
+		CreateObject(Rock, pos[0], pos[1])->SetSpeed(RandomX(-80, 80), RandomX(-80, 20));
+	}
+	return FX_OK;
+}
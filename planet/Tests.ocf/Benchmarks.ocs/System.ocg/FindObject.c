@@ -0,0 +1,40 @@
+// FindObject with mixed cheap and expensive search conditions
+
+global func BenchmarkFindObject()
+{
+	// Synthetic population spread over the whole landscape
+	for (var i = 0; i < 5000; ++i)
+	{
+		var obj = CreateObject(Rock, Random(LandscapeWidth()), Random(LandscapeHeight()));
+		if (!Random(4))
+			obj->SetCategory(C4D_StaticBack);
+	}
+	Schedule(nil, "RunFindObjectQueries(2000)", 1);
+}
+
+global func RunFindObjectQueries(int query_count)
+{
+	var wdt = LandscapeWidth(), hgt = LandscapeHeight();
+	// The script callback is given first on purpose; cheaper conditions should still be checked before it
+	var t = GetTime();
+	for (var i = 0; i < query_count; ++i)
+		FindObjects(Find_Func("GetMass"), Find_Distance(100, Random(wdt), Random(hgt)), Find_OCF(OCF_Collectible));
+	FixLenLog("Distance + OCF + Func", GetTime() - t, LOG_LINE_LEN, "ms");
+
+	t = GetTime();
+	for (var i = 0; i < query_count; ++i)
+		FindObjects(Find_InRect(Random(wdt), Random(hgt), 200, 200), Find_Category(C4D_StaticBack));
+	FixLenLog("InRect + Category", GetTime() - t, LOG_LINE_LEN, "ms");
+
+	t = GetTime();
+	for (var i = 0; i < query_count; ++i)
+		ObjectCount(Find_Or(Find_Property("Collectible"), Find_Category(C4D_StaticBack)), Find_AtRect(Random(wdt), Random(hgt), 150, 150));
+	FixLenLog("AtRect + Or(Property, Category)", GetTime() - t, LOG_LINE_LEN, "ms");
+
+	t = GetTime();
+	for (var i = 0; i < query_count / 10; ++i)
+		FindObject(Find_Func("GetMass"), Find_Category(C4D_Vehicle));
+	FixLenLog("Global Category miss + Func", GetTime() - t, LOG_LINE_LEN, "ms");
+
+	BenchmarkDone();
+}
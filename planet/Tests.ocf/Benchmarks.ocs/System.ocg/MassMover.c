@@ -0,0 +1,37 @@
+// A whole lake flooding an empty basin. This replaces the landscape, so it runs last.
+
+global func BenchmarkMassMover()
+{
+	var wdt = LandscapeWidth(), hgt = LandscapeHeight();
+	// Empty basin with a full lake on top of a granite shelf
+	ClearFreeRect(0, 0, wdt, hgt);
+	DrawMaterialQuad("Granite", 0, hgt - 20, wdt, hgt - 20, wdt, hgt, 0, hgt);
+	DrawMaterialQuad("Granite", 0, hgt / 2, wdt, hgt / 2, wdt, hgt / 2 + 10, 0, hgt / 2 + 10);
+	DrawMaterialQuad("Water", 0, 0, wdt, 0, wdt, hgt / 2, 0, hgt / 2);
+	Schedule(nil, "BreachMassMoverShelf()", 10);
+}
+
+global func BreachMassMoverShelf()
+{
+	// Remove most of the shelf, so the whole lake floods the basin
+	var wdt = LandscapeWidth(), hgt = LandscapeHeight();
+	ClearFreeRect(wdt / 10, hgt / 2, wdt * 8 / 10, 10);
+	var fx = AddEffect("IntMeasureFlood", nil, 1, 1);
+	fx.start = GetTime();
+	fx.last = fx.start;
+}
+
+global func FxIntMeasureFloodTimer(object target, proplist fx, int time)
+{
+	var log_interval = 100;
+	if (time % log_interval)
+		return FX_OK;
+	var now = GetTime();
+	FixLenLog(Format("Frames %d-%d (ms per %d frames)", time - log_interval, time, log_interval), now - fx.last, LOG_LINE_LEN, "ms");
+	fx.last = now;
+	if (time < 1000)
+		return FX_OK;
+	FixLenLog("Total", now - fx.start, LOG_LINE_LEN, "ms");
+	BenchmarkDone();
+	return FX_Execute_Kill;
+}
@@ -0,0 +1,53 @@
+// Filling, copying and clearing large arrays of object references
+
+global func BenchmarkObjectReference()
+{
+	var object_count = 200, ref_count = 20000, round_count = 20;
+	var objects = [];
+	for (var i = 0; i < object_count; ++i)
+		PushBack(objects, CreateObject(Rock, Random(LandscapeWidth()), Random(LandscapeHeight())));
+	var busy = objects[0];
+
+	// Many references to a single object, released in the order they were taken
+	var t = GetTime();
+	for (var round = 0; round < round_count; ++round)
+	{
+		var refs = CreateArray(ref_count);
+		for (var i = 0; i < ref_count; ++i)
+			refs[i] = busy;
+		for (var i = 0; i < ref_count; ++i)
+			refs[i] = nil;
+	}
+	FixLenLog("Fill + clear, one object", GetTime() - t, LOG_LINE_LEN, "ms");
+
+	// Arrays of references to many objects, copied and modified
+	t = GetTime();
+	for (var round = 0; round < round_count; ++round)
+	{
+		var refs = CreateArray(ref_count);
+		for (var i = 0; i < ref_count; ++i)
+			refs[i] = objects[i % object_count];
+		var copy = refs[:];
+		for (var i = 0; i < ref_count; i += 2)
+			copy[i] = objects[(i + round) % object_count];
+		refs = nil;
+		copy = nil;
+	}
+	FixLenLog("Copy + reassign, many objects", GetTime() - t, LOG_LINE_LEN, "ms");
+
+	// Removing objects that are still referenced from large arrays
+	t = GetTime();
+	var keep = [];
+	for (var obj in objects)
+	{
+		var refs = CreateArray(ref_count / object_count);
+		for (var i = 0; i < GetLength(refs); ++i)
+			refs[i] = obj;
+		PushBack(keep, refs);
+	}
+	for (var obj in objects)
+		obj->RemoveObject();
+	FixLenLog("Remove referenced objects", GetTime() - t, LOG_LINE_LEN, "ms");
+
+	BenchmarkDone();
+}
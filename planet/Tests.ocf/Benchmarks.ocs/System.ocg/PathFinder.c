@@ -0,0 +1,36 @@
+// GetPathLength with and without transfer zones
+
+global func BenchmarkPathFinder()
+{
+	var query_count = 200, zone_count = 100;
+	// Same start and target points for every run
+	var points = [];
+	for (var i = 0; i < query_count; ++i)
+		PushBack(points, [FindFreePoint(), FindFreePoint()]);
+
+	var t = GetTime();
+	var found = RunPathQueries(points);
+	FixLenLog(Format("%d queries, %d paths found", query_count, found), GetTime() - t, LOG_LINE_LEN, "ms");
+
+	// Again with transfer zones spread over the map
+	for (var i = 0; i < zone_count; ++i)
+	{
+		var pos = FindFreePoint();
+		var zone = CreateObject(Rock, pos[0], pos[1]);
+		zone->SetTransferZone(-10, -40, 20, 80);
+	}
+	t = GetTime();
+	found = RunPathQueries(points);
+	FixLenLog(Format("%d queries with %d zones", query_count, zone_count), GetTime() - t, LOG_LINE_LEN, "ms");
+
+	BenchmarkDone();
+}
+
+global func RunPathQueries(array points)
+{
+	var found = 0;
+	for (var p in points)
+		if (GetPathLength(p[0][0], p[0][1], p[1][0], p[1][1], 1) != nil)
+			++found;
+	return found;
+}
@@ -24,6 +24,7 @@
 class C4AbstractApp;
 class C4Action;
 class C4AulBCC;
+struct C4AulCallCache;
 class C4AulDefFunc;
 class C4AulExec;
 class C4AulFunc;
@@ -124,6 +124,8 @@
 #define C4CFN_PlayerInfos     "PlayerInfos.txt"
 #define C4CFN_SavePlayerInfos "SavePlayerInfos.txt"
 #define C4CFN_RecPlayerInfos  "RecPlayerInfos.txt"
+#define C4CFN_RecSnapshots    "Snapshots.txt"
+#define C4CFN_RecSnapshot     "Snapshot%08d.ocs"
 #define C4CFN_Teams           "Teams.txt"
 #define C4CFN_Parameters      "Parameters.txt"
 #define C4CFN_RoundResults    "RoundResults.txt"
@@ -146,6 +148,8 @@
 #define C4CFN_Titles          "Title*.txt|Title.txt"
 #define C4CFN_DefNameFiles    "Names*.txt|Names.txt"
 #define C4CFN_EditorGeometry  "Editor.geometry"
+#define C4CFN_DefCoreCache    "DefCore.cache"
+#define C4CFN_ScriptProfile   "ScriptProfile.txt"
 #define C4CFN_DefaultScenarioTemplate "Empty.ocs"
 
 #define C4CFN_TempMusic       "~Music.tmp"
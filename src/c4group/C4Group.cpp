@@ -1091,9 +1091,25 @@ bool C4Group::SetFilePtr(int iOffset)
 	// ensure mother is at correct pos
 	if (p->Mother) p->Mother->EnsureChildFilePtr(this);
 
-	// Rewind if necessary
+	// Jump back if necessary
 	if (p->FilePtr>iOffset)
-		if (!RewindFilePtr()) return false;
+	{
+		// Child group in packed mother: move mother directly to the target
+		if (p->Mother && p->Mother->p->SourceType==P::ST_Packed)
+		{
+			if (!p->Mother->SetFilePtr(p->MotherOffset + p->EntryOffset + iOffset))
+				return false;
+			p->FilePtr = iOffset;
+		}
+		// Regular group: seek in standard file, which only needs to decompress from the last seek point
+		else if (!p->Mother)
+		{
+			if (p->StdFile.Seek(p->EntryOffset + iOffset, SEEK_SET) < 0)
+				return false;
+			p->FilePtr = iOffset;
+		}
+		else if (!RewindFilePtr()) return false;
+	}
 
 	// Advance to target pointer
 	if (p->FilePtr<iOffset)
@@ -1115,11 +1131,7 @@ bool C4Group::Advance(int iOffset)
 	}
 	// uncached advance
 	if (p->SourceType == P::ST_Unpacked) return !!p->StdFile.Advance(iOffset);
-	// FIXME: reading the file one byte at a time sounds just slow.
-	BYTE buf;
-	for (; iOffset>0; iOffset--)
-		if (!Read(&buf,1)) return false;
-	return true;
+	return AdvanceFilePtr(iOffset);
 }
 
 bool C4Group::Read(void *pBuffer, size_t iSize)
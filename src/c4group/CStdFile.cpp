@@ -307,15 +307,29 @@ bool CStdFile::Advance(int iOffset)
 
 int CStdFile::Seek(long int offset, int whence)
 {
-	// seek in file by offset and stdio-style SEEK_* constants. Only implemented for uncompressed files.
-	assert(!hgzFile);
+	// seek in file by offset and stdio-style SEEK_* constants. SEEK_END is only implemented for uncompressed files.
+	if (hgzFile)
+	{
+		assert(whence != SEEK_END);
+		if (ModeWrite) return -1;
+		if (whence == SEEK_CUR) offset += Tell();
+		// Target still in the buffer?
+		long int buffer_start = c4_gztell(hgzFile) - BufferLoad;
+		if (offset >= buffer_start && offset <= buffer_start + BufferLoad)
+		{
+			BufferPtr = offset - buffer_start;
+			return 0;
+		}
+		ClearBuffer();
+		return c4_gzseek(hgzFile, offset, SEEK_SET) < 0 ? -1 : 0;
+	}
 	return fseek(hFile, offset, whence);
 }
 
 long int CStdFile::Tell()
 {
-	// get current file pos. Only implemented for uncompressed files.
-	assert(!hgzFile);
+	// get current file pos. Compressed files report the position in the uncompressed data.
+	if (hgzFile) return ModeWrite ? c4_gztell(hgzFile) + BufferLoad : c4_gztell(hgzFile) - (BufferLoad - BufferPtr);
 	return ftell(hFile);
 }
 
@@ -63,8 +63,8 @@ public:
 	bool WriteString(const char *szStr);
 	bool Rewind();
 	bool Advance(int iOffset) override;
-	int Seek(long int offset, int whence); // seek in file by offset and stdio-style SEEK_* constants. Only implemented for uncompressed files.
-	long int Tell(); // get current file pos. Only implemented for uncompressed files.
+	int Seek(long int offset, int whence); // seek in file by offset and stdio-style SEEK_* constants. SEEK_END only implemented for uncompressed files.
+	long int Tell(); // get current file pos. For compressed files, this is the position in the uncompressed data.
 	bool IsOpen() const { return hFile || hgzFile; }
 	// flush contents to disk
 	inline bool Flush() { if (ModeWrite && BufferLoad) return SaveBuffer(); else return true; }
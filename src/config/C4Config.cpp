@@ -64,6 +64,7 @@ void C4ConfigGeneral::CompileFunc(StdCompiler *pComp)
 	pComp->Value(mkNamingAdapt(s(MissionAccess),    "MissionAccess",      "", false, true));
 	pComp->Value(mkNamingAdapt(FPS,                 "FPS",                0              ));
 	pComp->Value(mkNamingAdapt(DefRec,              "DefRec",             0              ));
+	pComp->Value(mkNamingAdapt(RecordSnapshotInterval, "RecordSnapshotInterval", 0       ));
 	pComp->Value(mkNamingAdapt(ScreenshotFolder,    "ScreenshotFolder",   "Screenshots",  false, true));
 	pComp->Value(mkNamingAdapt(ScrollSmooth,        "ScrollSmooth",       4              ));
 	pComp->Value(mkNamingAdapt(AlwaysDebug,         "DebugMode",          0              ));
@@ -178,6 +179,7 @@ void C4ConfigNetwork::CompileFunc(StdCompiler *pComp)
 #endif
 	pComp->Value(mkNamingAdapt(AsyncMaxWait,            "AsyncMaxWait",         2             ));
 	pComp->Value(mkNamingAdapt(PacketLogging,           "PacketLogging",        0             ));
+	pComp->Value(mkNamingAdapt(PacketCompression,       "PacketCompression",    1             ));
 	
 
 	pComp->Value(mkNamingAdapt(s(PuncherAddress),       "PuncherAddress",       "netpuncher.openclonk.org:11115"));
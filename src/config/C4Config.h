@@ -45,6 +45,7 @@ public:
 	char MissionAccess[CFG_MaxString+1];
 	int32_t FPS;
 	int32_t DefRec;
+	int32_t RecordSnapshotInterval; // frames between game state snapshots in records; 0 for none
 	int32_t MMTimer;  // use multimedia-timers
 	int32_t ScrollSmooth; // view movement smoothing
 	int32_t ConfigResetSafety; // safety value: If this value is screwed, the config got corrupted and must be reset
@@ -166,6 +167,7 @@ public:
 #endif
 	int32_t AsyncMaxWait;
 	int32_t PacketLogging;
+	int32_t PacketCompression;
 public:
 	void CompileFunc(StdCompiler *pComp);
 	const char *GetLeagueServerAddress();
@@ -754,6 +754,45 @@ void C4ControlSyncCheck::Set()
 	ObjectCount = ::Objects.ObjectCount();
 	ObjectEnumerationIndex = C4PropListNumbered::GetEnumerationIndex();
 	SectShapeSum = ::Objects.Sectors.getShapeSum();
+	GetObjectHashes();
+	// hash one landscape strip only, so the whole landscape is covered every few thousand frames
+	LandscapeStrip = (Frame / C4SyncCheckLandscapeStripFrames) % C4SyncCheckLandscapeStrips;
+	int32_t iStripHgt = (::Landscape.GetHeight() + C4SyncCheckLandscapeStrips - 1) / C4SyncCheckLandscapeStrips;
+	LandscapeHash = ::Landscape.GetSyncHash(LandscapeStrip * iStripHgt, iStripHgt);
+}
+
+void C4ControlSyncCheck::GetObjectHashes()
+{
+	for (uint32_t &rHash : ObjectHashes)
+		rHash = crc32(0, nullptr, 0);
+	for (C4Object *pObj : ::Objects)
+	{
+		// raw movement state; C4Real has the same size in fixed and float builds
+		struct { int32_t Number, Con; C4Real x, y, r, xdir, ydir, rdir; } State =
+			{ pObj->Number, pObj->GetCon(), pObj->fix_x, pObj->fix_y, pObj->fix_r, pObj->xdir, pObj->ydir, pObj->rdir };
+		uint32_t &rHash = ObjectHashes[pObj->Number % C4SyncCheckObjectBuckets];
+		rHash = crc32(rHash, reinterpret_cast<const Bytef *>(&State), sizeof(State));
+	}
+}
+
+void C4ControlSyncCheck::LogHashMismatch(const C4ControlSyncCheck &rOther) const
+{
+	// objects: list the local candidates of every bucket that differs
+	for (int32_t i = 0; i < C4SyncCheckObjectBuckets; ++i)
+		if (ObjectHashes[i] != rOther.ObjectHashes[i])
+		{
+			StdStrBuf Objs;
+			for (C4Object *pObj : ::Objects)
+				if (pObj->Number % C4SyncCheckObjectBuckets == i)
+					Objs.AppendFormat(" #%d %s(%d/%d)", (int) pObj->Number, pObj->GetName(), (int) pObj->GetX(), (int) pObj->GetY());
+			LogFatal(FormatString("Network: Object hash mismatch in bucket %d:%s", (int) i, Objs.getData()).getData());
+		}
+	// landscape
+	if (LandscapeHash != rOther.LandscapeHash)
+	{
+		int32_t iStripHgt = (::Landscape.GetHeight() + C4SyncCheckLandscapeStrips - 1) / C4SyncCheckLandscapeStrips;
+		LogFatal(FormatString("Network: Landscape hash mismatch in rows %d to %d", (int) (LandscapeStrip * iStripHgt), (int) ((LandscapeStrip + 1) * iStripHgt - 1)).getData());
+	}
 }
 
 int32_t C4ControlSyncCheck::GetAllCrewPosX()
@@ -787,7 +826,9 @@ void C4ControlSyncCheck::Execute() const
 	     || MassMoverIndex         != pSyncCheck->MassMoverIndex
 	     || ObjectCount            != pSyncCheck->ObjectCount
 	     || ObjectEnumerationIndex != pSyncCheck->ObjectEnumerationIndex
-	     || SectShapeSum           != pSyncCheck->SectShapeSum)
+	     || SectShapeSum           != pSyncCheck->SectShapeSum
+	     || LandscapeHash          != pSyncCheck->LandscapeHash
+	     || !std::equal(ObjectHashes, ObjectHashes + C4SyncCheckObjectBuckets, pSyncCheck->ObjectHashes))
 	{
 		const char *szThis = "Client", *szOther = ::Control.isReplay() ? "Rec ":"Host";
 		if (iByClient != ::Control.ClientID())
@@ -796,6 +837,7 @@ void C4ControlSyncCheck::Execute() const
 		LogFatal("Network: Synchronization loss!");
 		LogFatal(FormatString("Network: %s Frm %i Ctrl %i Rnc %i Cpx %i PXS %i MMi %i Obc %i Oei %i Sct %i", szThis, Frame,ControlTick,RandomCount,AllCrewPosX,PXSCount,MassMoverIndex,ObjectCount,ObjectEnumerationIndex, SectShapeSum).getData());
 		LogFatal(FormatString("Network: %s Frm %i Ctrl %i Rnc %i Cpx %i PXS %i MMi %i Obc %i Oei %i Sct %i", szOther, SyncCheck.Frame,SyncCheck.ControlTick,SyncCheck.RandomCount,SyncCheck.AllCrewPosX,SyncCheck.PXSCount,SyncCheck.MassMoverIndex,SyncCheck.ObjectCount,SyncCheck.ObjectEnumerationIndex, SyncCheck.SectShapeSum).getData());
+		LogHashMismatch(SyncCheck);
 		StartSoundEffect("UI::SyncError");
 #ifdef _DEBUG
 		// Debug safe
@@ -827,6 +869,9 @@ void C4ControlSyncCheck::CompileFunc(StdCompiler *pComp)
 	pComp->Value(mkNamingAdapt(mkIntPackAdapt(ObjectCount), "ObjectCount", 0));
 	pComp->Value(mkNamingAdapt(mkIntPackAdapt(ObjectEnumerationIndex), "ObjectEnumerationIndex", 0));
 	pComp->Value(mkNamingAdapt(mkIntPackAdapt(SectShapeSum), "SectShapeSum", 0));
+	pComp->Value(mkNamingAdapt(toC4CArrU(ObjectHashes), "ObjectHashes"));
+	pComp->Value(mkNamingAdapt(mkIntPackAdapt(LandscapeStrip), "LandscapeStrip", 0));
+	pComp->Value(mkNamingAdapt(LandscapeHash, "LandscapeHash", 0u));
 	C4ControlPacket::CompileFunc(pComp);
 }
 
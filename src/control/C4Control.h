@@ -314,6 +314,12 @@ public:
 	DECLARE_C4CONTROL_VIRTUALS
 };
 
+// state hashes in sync checks: objects are hashed in buckets by number, the landscape
+// is hashed one horizontal strip at a time, so mismatches can be narrowed down
+const int32_t C4SyncCheckObjectBuckets = 16,
+              C4SyncCheckLandscapeStrips = 16,
+              C4SyncCheckLandscapeStripFrames = 100; // not the sync check rate, which differs in debug builds
+
 class C4ControlSyncCheck : public C4ControlPacket // not sync
 {
 public:
@@ -328,6 +334,9 @@ protected:
 	int32_t ObjectCount;
 	int32_t ObjectEnumerationIndex;
 	int32_t SectShapeSum;
+	uint32_t ObjectHashes[C4SyncCheckObjectBuckets];
+	int32_t LandscapeStrip;
+	uint32_t LandscapeHash;
 public:
 	void Set();
 	int32_t getFrame() const { return Frame; }
@@ -335,6 +344,8 @@ public:
 	DECLARE_C4CONTROL_VIRTUALS
 protected:
 	static int32_t GetAllCrewPosX();
+	void GetObjectHashes();
+	void LogHashMismatch(const C4ControlSyncCheck &rOther) const;
 };
 
 class C4ControlSynchronize : public C4ControlPacket // sync
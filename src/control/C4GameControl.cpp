@@ -130,6 +130,9 @@ void C4GameControl::OnGameSynchronizing()
 		fRecordNeeded = false;
 		StartRecord(false, false);
 	}
+	// otherwise, save a record snapshot if desired
+	else if (pRecord && Config.General.RecordSnapshotInterval > 0)
+		pRecord->SaveSnapshot(!!pExecutingControl);
 }
 
 bool C4GameControl::StartRecord(bool fInitial, bool fStreaming)
@@ -280,6 +283,13 @@ void C4GameControl::Execute()
 	if (!isReplay() && Game.FrameCounter % ControlRate)
 		return;
 
+	// record snapshots are saved at synchronization, so replays synchronize at the same frames
+	if (pRecord && fHost && pRecord->IsSnapshotDue(Game.FrameCounter))
+	{
+		pRecord->DelaySnapshot(Game.FrameCounter);
+		DoInput(CID_Synchronize, new C4ControlSynchronize(false, false), CDT_Queue);
+	}
+
 	// Get control
 	C4Control Control;
 	if (eMode == CM_Local)
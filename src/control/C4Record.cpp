@@ -97,6 +97,14 @@ void C4RecordChunk::CompileFunc(StdCompiler *pComp)
 	}
 }
 
+void C4RecordSnapshot::CompileFunc(StdCompiler *pComp)
+{
+	pComp->Value(mkNamingAdapt(Frame, "Frame", 0));
+	pComp->Value(mkNamingAdapt(Name, "Name", ""));
+	pComp->Value(mkNamingAdapt(CtrlPos, "CtrlPos", 0u));
+	pComp->Value(mkNamingAdapt(CtrlFrame, "CtrlFrame", 0u));
+}
+
 C4Record::C4Record() = default;
 
 C4Record::~C4Record() = default;
@@ -163,6 +171,10 @@ bool C4Record::Start(bool fInitial)
 	fStreaming = false;
 	fRecording = true;
 	iLastFrame = 0;
+	iCtrlRecPos = iLastCtrlPos = iLastCtrlFrame = 0;
+	Snapshots.clear();
+	iSnapshotInterval = Config.General.RecordSnapshotInterval;
+	DelaySnapshot(Game.FrameCounter);
 	return true;
 }
 
@@ -243,9 +255,16 @@ bool C4Record::Rec(int iFrame, const StdBuf &sBuf, C4RecordChunkType eType)
 	iLastFrame += iFrameDiff;
 	// create head
 	C4RecordChunkHead Head = { iFrameDiff, uint8_t(eType) };
+	// remember control position for snapshots
+	if (eType == RCT_Ctrl)
+	{
+		iLastCtrlPos = iCtrlRecPos;
+		iLastCtrlFrame = iLastFrame - iFrameDiff;
+	}
 	// pack
 	CtrlRec.Write(&Head, sizeof(Head));
 	CtrlRec.Write(sBuf.getData(), sBuf.getSize());
+	iCtrlRecPos += sizeof(Head) + sBuf.getSize();
 #ifdef IMMEDIATEREC
 	// immediate rec: always flush
 	CtrlRec.Flush();
@@ -308,6 +327,58 @@ bool C4Record::AddFile(const char *szLocalFilename, const char *szAddAs, bool fD
 	return true;
 }
 
+bool C4Record::IsSnapshotDue(int32_t iFrame) const
+{
+	return fRecording && iSnapshotInterval > 0 && iFrame >= iNextSnapshotFrame;
+}
+
+void C4Record::DelaySnapshot(int32_t iFrame)
+{
+	iNextSnapshotFrame = iFrame + std::max<int32_t>(iSnapshotInterval, 1);
+}
+
+bool C4Record::SaveSnapshot(bool fInControl)
+{
+	if (!fRecording) return false;
+	// Playback from the snapshot starts like a record started at this point:
+	// With the control currently being executed, if any
+	C4RecordSnapshot Snapshot;
+	Snapshot.Frame = Game.FrameCounter;
+	Snapshot.Name.Format(C4CFN_RecSnapshot, Game.FrameCounter);
+	Snapshot.CtrlPos = fInControl ? iLastCtrlPos : iCtrlRecPos;
+	Snapshot.CtrlFrame = fInControl ? iLastCtrlFrame : iLastFrame;
+	// Same frame twice (e.g. multiple synchronizations)? Keep the first one.
+	if (!Snapshots.empty() && Snapshots.back().Frame == Snapshot.Frame) return true;
+	// Save it into the record folder
+	C4GameSaveRecord saveRec(false, Index, Game.Parameters.isLeague());
+	if (!saveRec.Save(FormatString("%s" DirSep "%s", sFilename.getData(), Snapshot.Name.getData()).getData()))
+		return false;
+	saveRec.Close();
+	Snapshots.push_back(Snapshot);
+	// Too many? Drop every other one and double the interval, so long records
+	// keep evenly spread snapshots of bounded total size
+	if (Snapshots.size() > MaxSnapshots)
+	{
+		std::vector<C4RecordSnapshot> Kept;
+		for (size_t i = 0; i < Snapshots.size(); ++i)
+			if (i % 2)
+				EraseItem(FormatString("%s" DirSep "%s", sFilename.getData(), Snapshots[i].Name.getData()).getData());
+			else
+				Kept.push_back(Snapshots[i]);
+		Snapshots.swap(Kept);
+		iSnapshotInterval *= 2;
+	}
+	DelaySnapshot(Game.FrameCounter);
+	// Update the index right away, so snapshots can be used if the record is never stopped
+	return SaveSnapshotIndex();
+}
+
+bool C4Record::SaveSnapshotIndex()
+{
+	return DecompileToBuf<StdCompilerINIWrite>(mkNamingAdapt(mkSTLContainerAdapt(Snapshots), "Snapshot")).SaveToFile(
+	         FormatString("%s" DirSep C4CFN_RecSnapshots, sFilename.getData()).getData());
+}
+
 bool C4Record::StartStreaming(bool fInitial)
 {
 	if (!fRecording) return false;
@@ -389,11 +460,18 @@ bool C4Playback::Open(C4Group &rGrp)
 	// open group? Then do some sequential reading for large files
 	// Can't do this when a dump is forced, because the dump needs all data
 	// Also can't do this when stripping is desired
-	fLoadSequential = !rGrp.IsPacked() && !Game.RecordDumpFile.getLength() && !fStrip;
+	// Snapshots in records have no control of their own
+	bool fSnapshot = !rGrp.FindEntry(C4CFN_CtrlRec) && !rGrp.FindEntry(C4CFN_CtrlRecText);
+	fLoadSequential = !rGrp.IsPacked() && !Game.RecordDumpFile.getLength() && !fStrip && !fSnapshot;
 
 	// get text record file
 	StdStrBuf TextBuf;
-	if (rGrp.LoadEntryString(C4CFN_CtrlRecText, &TextBuf))
+	if (fSnapshot)
+	{
+		if (!OpenSnapshot(rGrp))
+			return false;
+	}
+	else if (rGrp.LoadEntryString(C4CFN_CtrlRecText, &TextBuf))
 	{
 		if (!ReadText(TextBuf))
 			return false;
@@ -501,10 +579,59 @@ bool C4Playback::Open(C4Group &rGrp)
 	return true;
 }
 
-bool C4Playback::ReadBinary(const StdBuf &Buf)
+bool C4Playback::OpenSnapshot(C4Group &rGrp)
+{
+	// open record the snapshot is contained in
+	StdStrBuf sSnapshot = rGrp.GetFullName();
+	char szRecord[_MAX_PATH+1];
+	SCopy(sSnapshot.getData(), szRecord, _MAX_PATH);
+	C4Group RecordGrp;
+	if (!TruncatePath(szRecord) || !RecordGrp.Open(szRecord))
+		{ LogFatal("Record: No control data found!"); return false; }
+	// look up snapshot
+	std::vector<C4RecordSnapshot> Snapshots;
+	if (!LoadSnapshots(RecordGrp, Snapshots))
+		{ LogFatal("Record: No snapshot index found!"); return false; }
+	const char *szName = GetFilename(sSnapshot.getData());
+	auto pSnapshot = std::find_if(Snapshots.begin(), Snapshots.end(),
+	                              [szName](const C4RecordSnapshot &s) { return SEqualNoCase(s.Name.getData(), szName); });
+	if (pSnapshot == Snapshots.end())
+		{ LogFatal(FormatString("Record: Snapshot %s not in index!", szName).getData()); return false; }
+	// play back the record's control from the snapshot on
+	StdBuf BinaryBuf;
+	if (!RecordGrp.LoadEntry(C4CFN_CtrlRec, &BinaryBuf) || pSnapshot->CtrlPos > BinaryBuf.getSize())
+		{ LogFatal("Record: No control data found!"); return false; }
+	LogF("Record: Playback from snapshot at frame %d", (int) pSnapshot->Frame);
+	return ReadBinary(BinaryBuf.getPart(pSnapshot->CtrlPos, BinaryBuf.getSize() - pSnapshot->CtrlPos), pSnapshot->CtrlFrame);
+}
+
+bool C4Playback::LoadSnapshots(C4Group &rGrp, std::vector<C4RecordSnapshot> &Snapshots)
+{
+	StdStrBuf Buf;
+	if (!rGrp.LoadEntryString(C4CFN_RecSnapshots, &Buf)) return false;
+	return CompileFromBuf_LogWarn<StdCompilerINIRead>(mkNamingAdapt(mkSTLContainerAdapt(Snapshots), "Snapshot"), Buf, C4CFN_RecSnapshots);
+}
+
+bool C4Playback::FindSnapshot(const char *szRecord, int32_t iFrame, StdStrBuf *pSnapshot)
+{
+	C4Group RecordGrp;
+	if (!RecordGrp.Open(szRecord)) return false;
+	std::vector<C4RecordSnapshot> Snapshots;
+	if (!LoadSnapshots(RecordGrp, Snapshots)) return false;
+	// last snapshot before that frame
+	const C4RecordSnapshot *pBest = nullptr;
+	for (const C4RecordSnapshot &Snapshot : Snapshots)
+		if (Snapshot.Frame <= iFrame && (!pBest || Snapshot.Frame > pBest->Frame))
+			pBest = &Snapshot;
+	if (!pBest) return false;
+	pSnapshot->Format("%s" DirSep "%s", szRecord, pBest->Name.getData());
+	return true;
+}
+
+bool C4Playback::ReadBinary(const StdBuf &Buf, uint32_t iStartFrame)
 {
 	// sequential reading: Take over rest from last buffer
-	const StdBuf *pUseBuf; uint32_t iFrame = 0;
+	const StdBuf *pUseBuf; uint32_t iFrame = iStartFrame;
 	if (fLoadSequential)
 	{
 		sequentialBuffer.Append(Buf);
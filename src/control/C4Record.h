@@ -119,6 +119,17 @@ public:
 	virtual ~C4RecordChunk() = default;
 };
 
+// game state saved into a record, to start playback from
+struct C4RecordSnapshot
+{
+	int32_t Frame{0};       // game frame the snapshot was saved at
+	StdCopyStrBuf Name;     // snapshot scenario in record group
+	uint32_t CtrlPos{0};    // position of first chunk to play back in control record
+	uint32_t CtrlFrame{0};  // frame of the chunk before that position
+
+	void CompileFunc(StdCompiler *pComp);
+};
+
 struct C4RCSetPix
 {
 	int x,y; // pos
@@ -249,6 +260,11 @@ private:
 	C4Group RecordGrp; // record scenario group
 	bool fRecording{false}; // set if recording is active
 	uint32_t iLastFrame; // frame of last chunk written
+	uint32_t iCtrlRecPos; // bytes written to control file
+	uint32_t iLastCtrlPos, iLastCtrlFrame; // position and previous frame of last control chunk
+	int32_t iSnapshotInterval; // frames between snapshots; doubled whenever old snapshots are thinned out
+	int32_t iNextSnapshotFrame; // frame at which the next snapshot is due
+	std::vector<C4RecordSnapshot> Snapshots; // snapshots saved so far
 	bool fStreaming{false}; // perdiodically sent new control to server
 	unsigned int iStreamingPos; // Position of current buffer in stream
 	StdBuf StreamingData; // accumulated control data since last stream sync
@@ -258,6 +274,8 @@ public:
 	~C4Record(); // destructor; close file; create demo scen
 	int Index;
 
+	static const size_t MaxSnapshots = 32; // more snapshots in a record are thinned out
+
 	bool IsRecording() const { return fRecording; } // return whether Start() has been called
 	unsigned int GetStreamingPos() const { return iStreamingPos; }
 	const StdBuf &GetStreamingBuf() const { return StreamingData; }
@@ -271,6 +289,10 @@ public:
 
 	bool AddFile(const char *szLocalFilename, const char *szAddAs, bool fDelete = false);
 
+	bool IsSnapshotDue(int32_t iFrame) const; // return whether a snapshot should be made at this frame
+	void DelaySnapshot(int32_t iFrame); // no further snapshot for the current interval
+	bool SaveSnapshot(bool fInControl); // save game state; must be called at synchronization
+
 	bool StartStreaming(bool fInitial);
 	void ClearStreamingBuf(unsigned int iAmount);
 	void StopStreaming();
@@ -279,6 +301,7 @@ public:
 
 private:
 	void Stream(const C4RecordChunkHead &Head, const StdBuf &sBuf);
+	bool SaveSnapshotIndex(); // write Snapshots.txt into the record folder
 	bool StreamFile(const char *szFilename, const char *szAddAs);
 };
 
@@ -300,7 +323,8 @@ public:
 	~C4Playback(); // destructor; deinit playback
 
 	bool Open(C4Group &rGrp);
-	bool ReadBinary(const StdBuf &Buf);
+	bool OpenSnapshot(C4Group &rGrp); // open record control from a snapshot on
+	bool ReadBinary(const StdBuf &Buf, uint32_t iStartFrame = 0); // start frame is for non-sequential reading only
 	bool ReadText(const StdStrBuf &Buf);
 	void NextChunk(); // point to next prepared chunk in mem or read it
 	bool NextSequentialChunk(); // read from seq file until a new chunk has been filled
@@ -313,6 +337,8 @@ public:
 	void Check(C4RecordChunkType eType, const uint8_t *pData, int iSize); // compare with debugrec
 	void DebugRecError(const char *szError);
 	static bool StreamToRecord(const char *szStream, StdStrBuf *pRecord);
+	static bool LoadSnapshots(C4Group &rGrp, std::vector<C4RecordSnapshot> &Snapshots);
+	static bool FindSnapshot(const char *szRecord, int32_t iFrame, StdStrBuf *pSnapshot); // get snapshot to seek to frame
 };
 
 #endif
@@ -36,6 +36,7 @@
 #endif
 #include "gui/C4Startup.h"
 #include "landscape/C4Particles.h"
+#include "lib/C4Stat.h"
 #include "network/C4Network2.h"
 #include "network/C4Network2IRC.h"
 #include "platform/C4GamePadCon.h"
@@ -233,6 +234,8 @@ void C4Application::ParseCommandLine(int argc, char * argv[])
 			{"startup", required_argument, nullptr, 's'},
 			{"stream", required_argument, nullptr, 'e'},
 			{"recdump", required_argument, nullptr, 'R'},
+			{"benchmark", required_argument, nullptr, 'B'},
+			{"seek", required_argument, nullptr, 'F'},
 			{"comment", required_argument, nullptr, 'm'},
 			{"pass", required_argument, nullptr, 'p'},
 			{"udpport", required_argument, nullptr, 'u'},
@@ -326,6 +329,10 @@ void C4Application::ParseCommandLine(int argc, char * argv[])
 		case 'm': Config.Network.Comment.CopyValidated(optarg); break;
 		// record dump
 		case 'R': Game.RecordDumpFile.Copy(optarg); break;
+		// replay benchmark
+		case 'B': ReplayBenchmarkFile = optarg; break;
+		// record playback start frame
+		case 'F': Game.RecordSeekFrame = std::max(atoi(optarg), 0); break;
 		// record stream
 		case 'e': Game.RecordStream.Copy(optarg); break;
 		// startup start screen
@@ -722,7 +729,12 @@ void C4Application::GameTick()
 	case C4AS_Game:
 		// Game
 		if (Game.IsRunning)
-			Game.Execute();
+		{
+			if (!ReplayBenchmarkFile.empty())
+				ExecuteReplayBenchmark();
+			else
+				Game.Execute();
+		}
 		// Sound
 		SoundSystem.Execute();
 		MusicSystem.Execute();
@@ -732,6 +744,59 @@ void C4Application::GameTick()
 	}
 }
 
+void C4Application::ExecuteReplayBenchmark()
+{
+	if (!::Control.isReplay() && !Game.GameOver)
+	{
+		LogFatal("Benchmark: Scenario is not a record");
+		Game.fQuitWithError = true;
+		QuitGame();
+		return;
+	}
+	// start measuring at the first frame
+	if (iReplayBenchmarkStartFrame < 0)
+	{
+		iReplayBenchmarkStartFrame = Game.FrameCounter;
+		tReplayBenchmarkStart = std::chrono::steady_clock::now();
+		C4Stat::getMainStat()->Reset();
+	}
+	// execute as many frames as possible, but keep the rest of the application alive
+	C4TimeMilliseconds tStop = C4TimeMilliseconds::Now() + 100;
+	while (Game.IsRunning && !Game.GameOver && C4TimeMilliseconds::Now() < tStop)
+		Game.Execute();
+	if (Game.IsRunning && !Game.GameOver)
+	{
+		NextTick();
+		return;
+	}
+	// playback done
+	uint64_t iTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tReplayBenchmarkStart).count();
+	if (!SaveReplayBenchmark(iTime, Game.FrameCounter - iReplayBenchmarkStartFrame))
+		Game.fQuitWithError = true;
+	QuitGame();
+}
+
+bool C4Application::SaveReplayBenchmark(uint64_t iTime, int32_t iFrames)
+{
+	StdCopyStrBuf Record(Game.ScenarioFilename);
+	Record.EscapeString();
+	StdStrBuf Report;
+	Report.AppendFormat("{\n\t\"record\": \"%s\",\n", Record.getData());
+	Report.AppendFormat("\t\"frames\": %d,\n", (int) iFrames);
+	// raw numbers only, so reports can be summed up and compared without rounding errors
+	Report.AppendFormat("\t\"time_us\": %llu,\n", (unsigned long long) iTime);
+	Report.Append("\t\"stats\": ");
+	C4Stat::getMainStat()->AppendJSON(Report);
+	Report.Append("\n}\n");
+	LogF("Benchmark: %d frames in %llu ms", (int) iFrames, (unsigned long long) (iTime / 1000));
+	if (!Report.SaveToFile(ReplayBenchmarkFile.c_str()))
+	{
+		LogF("Benchmark: Could not write %s", ReplayBenchmarkFile.c_str());
+		return false;
+	}
+	return true;
+}
+
 void C4Application::Draw()
 {
 	// Graphics
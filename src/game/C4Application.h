@@ -25,6 +25,8 @@
 #include "platform/C4MusicSystem.h"
 #include "platform/C4SoundSystem.h"
 
+#include <chrono>
+
 class C4ApplicationGameTimer;
 
 /* Main class to initialize configuration and execute the game */
@@ -78,6 +80,8 @@ public:
 	std::string IncomingUpdate;
 	// set by ParseCommandLine, for manually invoking an update check by command line or url
 	int CheckForUpdates{false};
+	// set by ParseCommandLine: run replay as fast as possible and write timings to this file
+	std::string ReplayBenchmarkFile;
 
 	bool FullScreenMode();
 	int GetConfigWidth()  { return (!FullScreenMode()) ? Config.Graphics.WindowX : Config.Graphics.ResX; }
@@ -100,6 +104,11 @@ protected:
 private:
 	// if set, this mission will be launched next
 	std::string NextMission;
+	// replay benchmark progress
+	std::chrono::steady_clock::time_point tReplayBenchmarkStart;
+	int32_t iReplayBenchmarkStartFrame{-1};
+	void ExecuteReplayBenchmark();
+	bool SaveReplayBenchmark(uint64_t iTime, int32_t iFrames); // iTime in microseconds
 	// version information strings
 	static const std::string Revision;
 };
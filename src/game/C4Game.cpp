@@ -121,6 +121,7 @@ bool C4Game::InitDefs()
 {
 	int32_t iDefs=0;
 	Log(LoadResStr("IDS_PRC_INITDEFS"));
+	::Definitions.LoadDefCoreCache();
 	int iDefResCount = 0;
 	C4GameRes *pDef;
 	for (pDef = Parameters.GameRes.iterRes(nullptr, NRT_Definitions); pDef; pDef = Parameters.GameRes.iterRes(pDef, NRT_Definitions))
@@ -140,6 +141,7 @@ bool C4Game::InitDefs()
 
 	// Load for scenario file - ignore sys group here, because it has been loaded already
 	iDefs+=::Definitions.Load(ScenarioFile,C4D_Load_RX,Config.General.LanguageEx,&Application.SoundSystem,true,true,35,40, false);
+	::Definitions.SaveDefCoreCache();
 
 	// Absolutely no defs: we don't like that
 	if (!iDefs) { LogFatal(LoadResStr("IDS_PRC_NODEFS")); return false; }
@@ -174,6 +176,16 @@ bool C4Game::OpenScenario()
 		SCopy(RecordFile.getData(), ScenarioFilename, _MAX_PATH);
 	}
 
+	// Seek in record: start from the last snapshot before that frame
+	if (RecordSeekFrame >= 0 && ScenarioFilename[0])
+	{
+		StdStrBuf Snapshot;
+		if (C4Playback::FindSnapshot(ScenarioFilename, RecordSeekFrame, &Snapshot))
+			SCopy(Snapshot.getData(), ScenarioFilename, _MAX_PATH);
+		else
+			LogF("Record: No snapshot before frame %d", (int) RecordSeekFrame);
+	}
+
 	// Scenario filename check & log
 	if (!ScenarioFilename[0]) { LogFatal(LoadResStr("IDS_PRC_NOC4S")); return false; }
 	LogF(LoadResStr("IDS_PRC_LOADC4S"),ScenarioFilename);
@@ -582,6 +594,7 @@ void C4Game::Clear()
 	GameText.Clear();
 	RecordDumpFile.Clear();
 	RecordStream.Clear();
+	RecordSeekFrame = -1;
 
 #ifdef WITH_QT_EDITOR
 	// clear console pointers held into script engine
@@ -1353,6 +1366,9 @@ void C4Game::ExecObjects() // Every Tick1 by Execute
 		Objects.ResortUnsorted();
 	}
 
+	// Drop flags of objects that left their sectors from the sector masks
+	Objects.Sectors.UpdateMasks();
+
 	if (Config.General.DebugRec)
 		AddDbgRec(RCT_Block, "ObjRm", 6);
 
@@ -1637,7 +1653,19 @@ void C4Game::DrawCrewOverheadText(C4TargetFacet &cgo, int32_t iPlayer)
 void C4Game::Ticks()
 {
 	// Frames
-	FrameCounter++; GameGo = FullSpeed;
+	FrameCounter++;
+	// Seeking in replay: Run fast until the frame is reached
+	if (RecordSeekFrame >= 0)
+	{
+		if (FrameCounter < RecordSeekFrame && Control.isReplay())
+			{ FullSpeed = true; FrameSkip = 50; }
+		else
+		{
+			if (Control.isReplay()) LogF("Record: Seek reached frame %d", (int) FrameCounter);
+			FullSpeed = false; FrameSkip = 1; RecordSeekFrame = -1;
+		}
+	}
+	GameGo = FullSpeed;
 	// Ticks
 	if (++iTick2==2)       iTick2=0;
 	if (++iTick3==3)       iTick3=0;
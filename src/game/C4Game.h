@@ -124,6 +124,7 @@ public:
 	bool Record;
 	StdStrBuf RecordDumpFile;
 	StdStrBuf RecordStream;
+	int32_t RecordSeekFrame{-1}; // if set, playback starts at the last snapshot before this frame and runs fast until it is reached
 	StdStrBuf TempScenarioFile;
 	bool fPreinited{false}; // set after PreInit has been called; unset by Clear and Default
 	int32_t FrameCounter;
@@ -40,6 +40,8 @@
 
 const int ALeft=0,ACenter=1,ARight=2;
 
+class CPNGFile;
+
 #ifndef USE_CONSOLE
 class CStdGL;
 class CStdGLCtx;
@@ -123,9 +125,13 @@ public:
 	bool SavePNG(C4Group &hGroup, const char *szFilename, bool fSaveAlpha=true, bool fSaveOverlayOnly=false);
 	bool SavePNG(const char *szFilename, bool fSaveAlpha, bool fSaveOverlayOnly, bool use_background_thread);
 	bool Read(CStdStream &hGroup, const char * extension, int iFlags);
+	bool ReadEntry(C4Group &hGroup, const char *szFilename, int iFlags); // read accessed entry; uses the image decoded in the background if there is one
 	bool ReadPNG(CStdStream &hGroup, int iFlags);
+	bool ReadPNG(CPNGFile &png, int iFlags);
 	bool ReadJPEG(CStdStream &hGroup, int iFlags);
 	bool ReadBMP(CStdStream &hGroup, int iFlags);
+	static void ScheduleDecoding(C4Group &hGroup, const char *szWildcard); // decode the cached png entries matching szWildcard on worker threads
+	static void DiscardDecoding(); // drop unused results of ScheduleDecoding. Must be called before the group is closed.
 
 	bool AttachPalette();
 	bool GetSurfaceSize(int &irX, int &irY); // get surface size
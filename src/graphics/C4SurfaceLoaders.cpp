@@ -123,7 +123,7 @@ bool C4Surface::Load(C4Group &hGroup, const char *szFilename, bool, bool fNoErrI
 		if (!fNoErrIfNotFound) LogF("%s: %s%c%s", LoadResStr("IDS_PRC_FILENOTFOUND"), hGroup.GetFullName().getData(), (char) DirectorySeparator, szFilename);
 		return false;
 	}
-	bool fSuccess = Read(hGroup, GetExtension(szFilename), iFlags);
+	bool fSuccess = ReadEntry(hGroup, szFilename, iFlags);
 	// loading error? log!
 	if (!fSuccess)
 		LogF("%s: %s%c%s", LoadResStr("IDS_ERR_NOFILE"), hGroup.GetFullName().getData(), (char) DirectorySeparator, szFilename);
@@ -147,6 +147,34 @@ bool C4Surface::Read(CStdStream &hGroup, const char * extension, int iFlags)
 		return false;
 }
 
+static StdStrBuf GetDecodingKey(C4Group &hGroup, const char *szFilename)
+{
+	return FormatString("%s%c%s", hGroup.GetFullName().getData(), (char) DirectorySeparator, szFilename);
+}
+
+void C4Surface::ScheduleDecoding(C4Group &hGroup, const char *szWildcard)
+{
+	assert(WildcardMatch("*.png", szWildcard));
+	for (const C4GroupEntry *entry = hGroup.GetFirstEntry(); entry; entry = entry->Next)
+		if (entry->bpMemBuf && WildcardMatch(szWildcard, entry->FileName))
+			CPNGFile::ScheduleLoading(GetDecodingKey(hGroup, entry->FileName).getData(), entry->bpMemBuf, entry->Size);
+}
+
+void C4Surface::DiscardDecoding()
+{
+	CPNGFile::DiscardLoads();
+}
+
+bool C4Surface::ReadEntry(C4Group &hGroup, const char *szFilename, int iFlags)
+{
+	if (SEqualNoCase(GetExtension(szFilename), "png"))
+	{
+		std::unique_ptr<CPNGFile> png = CPNGFile::TakeLoaded(GetDecodingKey(hGroup, szFilename).getData());
+		if (png) return ReadPNG(*png, iFlags);
+	}
+	return Read(hGroup, GetExtension(szFilename), iFlags);
+}
+
 bool C4Surface::ReadPNG(CStdStream &hGroup, int iFlags)
 {
 	// create mem block
@@ -161,6 +189,11 @@ bool C4Surface::ReadPNG(CStdStream &hGroup, int iFlags)
 	delete [] pData;
 	// abort if loading wasn't successful
 	if (!fSuccess) return false;
+	return ReadPNG(png, iFlags);
+}
+
+bool C4Surface::ReadPNG(CPNGFile &png, int iFlags)
+{
 	// create surface(s) - do not create an 8bit-buffer!
 	if (!Create(png.iWdt, png.iHgt, iFlags)) return false;
 	// lock for writing data
@@ -206,8 +239,7 @@ bool C4Surface::ReadPNG(CStdStream &hGroup, int iFlags)
 	// unlock
 	texture->Unlock();
 	Unlock();
-	// return if successful
-	return fSuccess;
+	return true;
 }
 
 bool C4Surface::SavePNG(C4Group &hGroup, const char *szFilename, bool fSaveAlpha, bool fSaveOverlayOnly)
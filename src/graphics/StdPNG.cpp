@@ -21,6 +21,8 @@
 #include "lib/StdColors.h"
 #include "platform/StdScheduler.h"
 
+#include <thread>
+
 // png reading proc
 void PNGAPI CPNGFile::CPNGReadFn(png_structp png_ptr, png_bytep data, size_t length)
 {
@@ -375,3 +377,142 @@ void CPNGFile::WaitForSaves()
 #endif
 	}
 }
+
+/* Background-threaded decoding of image files that are already in memory */
+
+class CPNGLoadThread : public StdThread
+{
+public:
+	struct Job
+	{
+		StdCopyStrBuf key;
+		BYTE *data;
+		int size;
+		std::unique_ptr<CPNGFile> png;
+		CStdEvent done{true};
+		Job(const char *key, BYTE *data, int size) : key(key), data(data), size(size) {}
+		void Execute();
+	};
+
+	static CStdCSec jobs_sec;
+	static CStdEvent jobs_pending; // set while there are queued jobs
+	static std::list<std::shared_ptr<Job>> queue; // jobs not yet started
+	static std::list<std::shared_ptr<Job>> jobs; // all jobs with unclaimed results
+
+	static void StartThreads();
+
+protected:
+	void Execute() override;
+};
+
+CStdCSec CPNGLoadThread::jobs_sec;
+CStdEvent CPNGLoadThread::jobs_pending(true);
+std::list<std::shared_ptr<CPNGLoadThread::Job>> CPNGLoadThread::queue;
+std::list<std::shared_ptr<CPNGLoadThread::Job>> CPNGLoadThread::jobs;
+
+namespace
+{
+	// Worker threads live until shutdown
+	class CPNGLoadThreads
+	{
+	public:
+		std::vector<std::unique_ptr<CPNGLoadThread>> threads;
+		~CPNGLoadThreads()
+		{
+			{
+				CStdLock lock(&CPNGLoadThread::jobs_sec);
+				for (auto &thread : threads) thread->SignalStop();
+				CPNGLoadThread::jobs_pending.Set();
+			}
+			for (auto &thread : threads) thread->Stop();
+			threads.clear();
+		}
+	} PNGLoadThreads;
+}
+
+void CPNGLoadThread::Job::Execute()
+{
+	png = std::make_unique<CPNGFile>();
+	if (!png->Load(data, size)) png.reset();
+	done.Set();
+}
+
+void CPNGLoadThread::StartThreads()
+{
+	if (!PNGLoadThreads.threads.empty()) return;
+	// Leave one core to the main thread, which keeps reading files meanwhile
+	unsigned int count = Clamp<unsigned int>(std::thread::hardware_concurrency(), 2, 5) - 1;
+	while (count--)
+	{
+		auto thread = std::make_unique<CPNGLoadThread>();
+		if (thread->Start()) PNGLoadThreads.threads.push_back(std::move(thread));
+	}
+}
+
+void CPNGLoadThread::Execute()
+{
+	jobs_pending.WaitFor(INFINITE);
+	std::shared_ptr<Job> job;
+	{
+		CStdLock lock(&jobs_sec);
+		if (queue.empty())
+		{
+			if (!IsStopSignaled()) jobs_pending.Reset();
+			return;
+		}
+		job = queue.front();
+		queue.pop_front();
+	}
+	job->Execute();
+}
+
+void CPNGFile::ScheduleLoading(const char *key, BYTE *pFile, int iSize)
+{
+	CPNGLoadThread::StartThreads();
+	// Without worker threads, the image is just decoded when it is needed
+	if (PNGLoadThreads.threads.empty()) return;
+	auto job = std::make_shared<CPNGLoadThread::Job>(key, pFile, iSize);
+	CStdLock lock(&CPNGLoadThread::jobs_sec);
+	CPNGLoadThread::queue.push_back(job);
+	CPNGLoadThread::jobs.push_back(job);
+	CPNGLoadThread::jobs_pending.Set();
+}
+
+std::unique_ptr<CPNGFile> CPNGFile::TakeLoaded(const char *key)
+{
+	std::shared_ptr<CPNGLoadThread::Job> job;
+	bool started = true;
+	{
+		CStdLock lock(&CPNGLoadThread::jobs_sec);
+		auto it = std::find_if(CPNGLoadThread::jobs.begin(), CPNGLoadThread::jobs.end(),
+		                       [key](const std::shared_ptr<CPNGLoadThread::Job> &job) { return SEqualNoCase(job->key.getData(), key); });
+		if (it == CPNGLoadThread::jobs.end()) return nullptr;
+		job = *it;
+		CPNGLoadThread::jobs.erase(it);
+		// Not picked up by a worker yet? Then it's faster to decode it right here.
+		auto queued = std::find(CPNGLoadThread::queue.begin(), CPNGLoadThread::queue.end(), job);
+		if (queued != CPNGLoadThread::queue.end())
+		{
+			CPNGLoadThread::queue.erase(queued);
+			started = false;
+		}
+	}
+	if (started)
+		job->done.WaitFor(INFINITE);
+	else
+		job->Execute();
+	return std::move(job->png);
+}
+
+void CPNGFile::DiscardLoads()
+{
+	std::list<std::shared_ptr<CPNGLoadThread::Job>> jobs;
+	{
+		CStdLock lock(&CPNGLoadThread::jobs_sec);
+		// Drop jobs that have not been started, and wait for the others to release their data
+		for (auto &job : CPNGLoadThread::queue) job->done.Set();
+		CPNGLoadThread::queue.clear();
+		jobs.swap(CPNGLoadThread::jobs);
+	}
+	for (auto &job : jobs) job->done.WaitFor(INFINITE);
+}
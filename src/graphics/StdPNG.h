@@ -67,6 +67,10 @@ public:
 	static void ScheduleSaving(CPNGFile *png, const char *filename); // start a background thread to save the png file. then free the passed png.
 	static void WaitForSaves(); // wait until all pending saves are finished
 
+	static void ScheduleLoading(const char *key, BYTE *pFile, int iSize); // decode file data in a background thread. pFile must stay valid until the result is taken or discarded.
+	static std::unique_ptr<CPNGFile> TakeLoaded(const char *key); // get the result of a scheduled load, waiting for it if necessary. nullptr if nothing was scheduled for key or decoding failed.
+	static void DiscardLoads(); // wait until all scheduled loads are finished and free unclaimed results
+
 private:
 	static void PNGAPI CPNGReadFn(png_structp png_ptr, png_bytep data, size_t length); // reading proc (callback)
 };
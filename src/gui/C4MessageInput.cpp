@@ -28,6 +28,7 @@
 #include "object/C4Object.h"
 #include "player/C4Player.h"
 #include "player/C4PlayerList.h"
+#include "script/C4AulExec.h"
 
 // --------------------------------------------------
 // C4ChatInputDialog
@@ -570,6 +571,7 @@ bool C4MessageInput::ProcessCommand(const char *szCommand)
 			LogF("/chart - %s", LoadResStr("IDS_TEXT_DISPLAYNETWORKSTATISTICS"));
 			LogF("/nodebug - %s", LoadResStr("IDS_TEXT_PREVENTDEBUGMODEINTHISROU"));
 			LogF("/script [script] - %s", LoadResStr("IDS_TEXT_EXECUTEASCRIPTCOMMAND"));
+			LogF("/profile [filename] - %s", LoadResStr("IDS_TEXT_PROFILESCRIPTCALLSTACKS"));
 			LogF("/screenshot [zoom] - %s", LoadResStr("IDS_TEXT_SAFEZOOMEDFULLSCREENSHOT"));
 		}
 		LogF("/kick [client] - %s", LoadResStr("IDS_TEXT_KICKTHESPECIFIEDCLIENT"));
@@ -594,6 +596,24 @@ bool C4MessageInput::ProcessCommand(const char *szCommand)
 		::Control.DoInput(CID_Script, new C4ControlScript(pCmdPar, C4ControlScript::SCOPE_Console), CDT_Decide);
 		return true;
 	}
+	// script call stack profiler. Only measures locally, so no control is needed.
+	if (SEqual(szCmdName, "profile"))
+	{
+		if (!Game.IsRunning) return false;
+		if (C4AulProfiler::IsRecordingStacks())
+		{
+			StdCopyStrBuf Filename(*pCmdPar ? pCmdPar : C4CFN_ScriptProfile);
+			if (!IsGlobalPath(Filename.getData()))
+				Filename.Copy(Config.AtUserDataPath(Filename.getData()));
+			C4AulProfiler::StopProfiling(Filename.getData());
+		}
+		else
+		{
+			C4AulProfiler::StartProfiling(nullptr, true);
+			Log(LoadResStr("IDS_MSG_SCRIPTPROFILERSTARTED"));
+		}
+		return true;
+	}
 	// set runtime properties
 	if (SEqual(szCmdName, "set"))
 	{
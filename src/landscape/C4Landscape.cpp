@@ -62,7 +62,9 @@ struct C4Landscape::P
 	bool Pix2Light[C4M_MaxTexIndex];
 	int32_t PixCntPitch = 0;
 	std::vector<uint8_t> PixCnt;
-	std::array<C4Rect, C4LS_MaxRelights> Relights;
+	std::vector<uint8_t> RelightTiles; // NoSave // one flag per tile of C4LS_RelightTileSize that needs a relight
+	int32_t RelightTilesX = 0, RelightTilesY = 0;
+	bool fRelightPending = false;
 	mutable std::array<std::unique_ptr<uint8_t[]>, C4M_MaxTexIndex> BridgeMatConversion; // NoSave //
 
 	LandscapeMode mode = LandscapeMode::Undefined;
@@ -84,6 +86,7 @@ struct C4Landscape::P
 	std::unique_ptr<C4FoW> pFoW;
 
 	void ClearMatCount();
+	void AddRelight(const C4Landscape *, C4Rect Rect);
 
 	void ExecuteScan(C4Landscape *);
 	int32_t DoScan(C4Landscape *, int32_t x, int32_t y, int32_t mat, int32_t dir);
@@ -221,19 +224,25 @@ void C4Landscape::P::ExecuteScan(C4Landscape *d)
 {
 	int32_t cy, mat;
 
-	// Check: Scan needed?
+	// Find out which materials convert at the current temperature, and in which scan direction.
+	// DoScan does nothing for the others, so they need not be passed to it.
 	const int32_t iTemperature = ::Weather.GetTemperature();
+	std::array<uint8_t, C4MaxMaterial> ConvertDirs{};
+	bool fScanNeeded = false;
 	for (mat = 0; mat < ::MaterialMap.Num; mat++)
-		if (MatCount[mat])
-		{
-			if (::MaterialMap.Map[mat].BelowTempConvertTo &&
-				iTemperature < ::MaterialMap.Map[mat].BelowTempConvert)
-				break;
-			else if (::MaterialMap.Map[mat].AboveTempConvertTo &&
-				iTemperature > ::MaterialMap.Map[mat].AboveTempConvert)
-				break;
-		}
-	if (mat >= ::MaterialMap.Num)
+	{
+		const C4Material &Mat = ::MaterialMap.Map[mat];
+		const bool fBelow = Mat.BelowTempConvertTo && iTemperature < Mat.BelowTempConvert;
+		const bool fAbove = Mat.AboveTempConvertTo && iTemperature > Mat.AboveTempConvert;
+		if (fBelow && Inside<int32_t>(Mat.BelowTempConvertDir, 0, 1))
+			ConvertDirs[mat] |= 1 << Mat.BelowTempConvertDir;
+		if (fAbove && Inside<int32_t>(Mat.AboveTempConvertDir, 0, 1))
+			ConvertDirs[mat] |= 1 << Mat.AboveTempConvertDir;
+		// Check: Scan needed?
+		if (MatCount[mat] && (fBelow || fAbove))
+			fScanNeeded = true;
+	}
+	if (!fScanNeeded)
 		return;
 
 	if (DEBUGREC_MATSCAN && Config.General.DebugRec)
@@ -251,10 +260,10 @@ void C4Landscape::P::ExecuteScan(C4Landscape *d)
 			if (last_mat != mat)
 			{
 				// upwards
-				if (last_mat != -1)
+				if (last_mat != -1 && (ConvertDirs[last_mat] & 2))
 					DoScan(d, ScanX, cy - 1, last_mat, 1);
 				// downwards
-				if (mat != -1)
+				if (mat != -1 && (ConvertDirs[mat] & 1))
 					cy += DoScan(d, ScanX, cy, mat, 0);
 			}
 			last_mat = mat;
@@ -387,27 +396,71 @@ void C4Landscape::Draw(C4TargetFacet &cgo, C4FoWRegion *pLight)
 	if (p->Modulation) pDraw->DeactivateBlitModulation();
 }
 
+void C4Landscape::P::AddRelight(const C4Landscape *d, C4Rect Rect)
+{
+	Rect.Intersect(C4Rect(0, 0, d->GetWidth(), d->GetHeight()));
+	if (Rect.Wdt <= 0 || Rect.Hgt <= 0) return;
+	if (RelightTiles.empty())
+	{
+		RelightTilesX = (d->GetWidth() + C4LS_RelightTileSize - 1) / C4LS_RelightTileSize;
+		RelightTilesY = (d->GetHeight() + C4LS_RelightTileSize - 1) / C4LS_RelightTileSize;
+		RelightTiles.resize(RelightTilesX * RelightTilesY, 0);
+	}
+	for (int32_t ty = Rect.y / C4LS_RelightTileSize; ty <= (Rect.y + Rect.Hgt - 1) / C4LS_RelightTileSize; ++ty)
+		for (int32_t tx = Rect.x / C4LS_RelightTileSize; tx <= (Rect.x + Rect.Wdt - 1) / C4LS_RelightTileSize; ++tx)
+			RelightTiles[ty * RelightTilesX + tx] = 1;
+	fRelightPending = true;
+}
+
 bool C4Landscape::DoRelights()
 {
 	if (!p->pLandscapeRender) return true;
-	for (int32_t i = 0; i < C4LS_MaxRelights; i++)
+	if (!p->fRelightPending) return true;
+	// Join the changed tiles: runs of tiles within a row, then runs of the
+	// same width in consecutive rows. Each resulting rect is updated once.
+	std::vector<C4Rect> Relights, Open, NextOpen;
+	for (int32_t ty = 0; ty < p->RelightTilesY; ++ty)
+	{
+		const uint8_t *pRow = &p->RelightTiles[ty * p->RelightTilesX];
+		for (int32_t tx = 0; tx < p->RelightTilesX; ++tx)
+		{
+			if (!pRow[tx]) continue;
+			int32_t tx0 = tx;
+			while (tx + 1 < p->RelightTilesX && pRow[tx + 1]) ++tx;
+			C4Rect Run(tx0 * C4LS_RelightTileSize, ty * C4LS_RelightTileSize, (tx - tx0 + 1) * C4LS_RelightTileSize, C4LS_RelightTileSize);
+			auto it = std::find_if(Open.begin(), Open.end(), [&Run](const C4Rect &r) { return r.x == Run.x && r.Wdt == Run.Wdt; });
+			if (it != Open.end())
+			{
+				Run.y = it->y;
+				Run.Hgt += it->Hgt;
+				Open.erase(it);
+			}
+			NextOpen.push_back(Run);
+		}
+		// Rects that did not continue in this row are done
+		Relights.insert(Relights.end(), Open.begin(), Open.end());
+		Open.swap(NextOpen);
+		NextOpen.clear();
+	}
+	Relights.insert(Relights.end(), Open.begin(), Open.end());
+	std::fill(p->RelightTiles.begin(), p->RelightTiles.end(), 0);
+	p->fRelightPending = false;
+
+	for (C4Rect &Relight : Relights)
 	{
-		if (!p->Relights[i].Wdt)
-			break;
+		Relight.Intersect(C4Rect(0, 0, GetWidth(), GetHeight()));
 		// Remove all solid masks in the (twice!) extended region around the change
-		C4Rect SolidMaskRect = p->pLandscapeRender->GetAffectedRect(p->Relights[i]);
+		C4Rect SolidMaskRect = p->pLandscapeRender->GetAffectedRect(Relight);
 		C4SolidMask * pSolid;
 		for (pSolid = C4SolidMask::Last; pSolid; pSolid = pSolid->Prev)
 			pSolid->RemoveTemporary(SolidMaskRect);
 		// Perform the update
-		p->pLandscapeRender->Update(p->Relights[i], this);
-		if (p->pFoW) p->pFoW->Ambient.UpdateFromLandscape(*this, p->Relights[i]);
+		p->pLandscapeRender->Update(Relight, this);
+		if (p->pFoW) p->pFoW->Ambient.UpdateFromLandscape(*this, Relight);
 		// Restore Solidmasks
 		for (pSolid = C4SolidMask::First; pSolid; pSolid = pSolid->Next)
 			pSolid->PutTemporary(SolidMaskRect);
 		C4SolidMask::CheckConsistency();
-		// Clear slot
-		p->Relights[i].Default();
 	}
 	return true;
 }
@@ -869,12 +922,7 @@ bool C4Landscape::_SetPix2(int32_t x, int32_t y, BYTE fgPix, BYTE bgPix)
 	if (p->pLandscapeRender)
 	{
 		C4Rect CheckRect = p->pLandscapeRender->GetAffectedRect(C4Rect(x, y, 1, 1));
-		for (int32_t i = 0; i < C4LS_MaxRelights; i++)
-			if (!p->Relights[i].Wdt || p->Relights[i].Overlap(CheckRect) || i + 1 >= C4LS_MaxRelights)
-			{
-				p->Relights[i].Add(CheckRect);
-				break;
-			}
+		p->AddRelight(this, CheckRect);
 		// Invalidate FoW
 		if (p->pFoW)
 			p->pFoW->Invalidate(CheckRect);
@@ -1373,9 +1421,10 @@ void C4Landscape::Clear(bool fClearMapCreator, bool fClearSky, bool fClearRender
 	p->pInitial.reset();
 	p->pInitialBkg.reset();
 	p->pFoW.reset();
-	// clear relight array
-	for (auto &relight : p->Relights)
-		relight.Default();
+	// clear relight tiles
+	p->RelightTiles.clear();
+	p->RelightTilesX = p->RelightTilesY = 0;
+	p->fRelightPending = false;
 	// clear scan
 	p->ScanX = 0;
 	p->mode = LandscapeMode::Undefined;
@@ -4211,6 +4260,21 @@ int32_t C4Landscape::GetEffectiveMatCount(int material) const
 	return p->EffectiveMatCount[material];
 }
 
+uint32_t C4Landscape::GetSyncHash(int32_t iY, int32_t iHgt) const
+{
+	if (!p->Surface8 || !p->Surface8Bkg) return 0;
+	iY = Clamp<int32_t>(iY, 0, GetHeight());
+	iHgt = Clamp<int32_t>(iHgt, 0, GetHeight() - iY);
+	// only hash visible pixels; the pitch padding is not synchronized
+	uLong crc = crc32(0, nullptr, 0);
+	for (int32_t y = iY; y < iY + iHgt; ++y)
+	{
+		crc = crc32(crc, p->Surface8->Bits + y * p->Surface8->Pitch, GetWidth());
+		crc = crc32(crc, p->Surface8Bkg->Bits + y * p->Surface8Bkg->Pitch, GetWidth());
+	}
+	return crc;
+}
+
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
 /* +++++++++++++++++++++++++++ Update functions ++++++++++++++++++++++++++++ */
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
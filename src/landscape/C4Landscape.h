@@ -24,7 +24,7 @@
 
 const int32_t C4MaxMaterial = 125;
 
-const int32_t C4LS_MaxRelights = 50;
+const int32_t C4LS_RelightTileSize = 64; // changed pixels are collected in tiles of this size for relighting
 
 enum class LandscapeMode
 {
@@ -152,6 +152,7 @@ public:
 
 	int32_t GetMatCount(int material) const;
 	int32_t GetEffectiveMatCount(int material) const;
+	uint32_t GetSyncHash(int32_t iY, int32_t iHgt) const; // checksum of both landscape layers in the given rows
 
 	int32_t DigFreeShape(int *vtcs, int length, C4Object *by_object = nullptr, bool no_dig2objects = false, bool no_instability_check = false);
 	void BlastFreeShape(int *vtcs, int length, C4Object *by_object = nullptr, int32_t by_player = NO_OWNER, int32_t iMaxDensity = C4M_Vehicle);
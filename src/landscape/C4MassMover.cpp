@@ -54,22 +54,19 @@ void C4MassMoverSet::Clear()
 
 void C4MassMoverSet::Execute()
 {
-	C4MassMover *cmm;
-	// Init counts
-	Count=0;
-	// Execute & count
+	// Execute twice, from top to bottom. Only slots holding a mover are
+	// visited, so quiet frames cost next to nothing. Movers created below
+	// the current slot are still executed in the same pass, as before.
 	for (int32_t speed = 2; speed>0; speed--)
-	{
-		cmm = &(Set[C4MassMoverChunk-1]);
-		for (int32_t cnt = 0; cnt<C4MassMoverChunk; cnt++,cmm--)
-			if (cmm->Mat!=MNone)
-				{ Count++; cmm->Execute(); }
-	}
+		for (int32_t cnt = GetLastActive(GetSize()-1); cnt>=0; cnt = GetLastActive(cnt-1))
+		{
+			Get(cnt).Execute();
+			if (Get(cnt).Mat==MNone) SetActive(cnt, false);
+		}
 }
 
 bool C4MassMoverSet::Create(int32_t x, int32_t y, bool fExecute)
 {
-	if (Count == C4MassMoverChunk) return false;
 	if (Config.General.DebugRec)
 	{
 		C4RCMassMover rc;
@@ -77,15 +74,26 @@ bool C4MassMoverSet::Create(int32_t x, int32_t y, bool fExecute)
 		AddDbgRec(RCT_MMC, &rc, sizeof(rc));
 	}
 	int32_t cptr=CreatePtr;
+	// Set full? Grow instead of dropping the mover
+	if (Count >= GetSize())
+	{
+		cptr=GetSize()-1;
+		Grow();
+	}
 	do
 	{
 		cptr++;
-		if (cptr>=C4MassMoverChunk) cptr=0;
-		if (Set[cptr].Mat==MNone)
+		if (cptr>=GetSize()) cptr=0;
+		if (Get(cptr).Mat==MNone)
 		{
-			if (!Set[cptr].Init(x,y)) return false;
+			if (!Get(cptr).Init(x,y)) return false;
 			CreatePtr=cptr;
-			if (fExecute) Set[cptr].Execute();
+			SetActive(cptr, true);
+			if (fExecute)
+			{
+				Get(cptr).Execute();
+				if (Get(cptr).Mat==MNone) SetActive(cptr, false);
+			}
 			return true;
 		}
 	}
@@ -93,6 +101,45 @@ bool C4MassMoverSet::Create(int32_t x, int32_t y, bool fExecute)
 	return false;
 }
 
+void C4MassMoverSet::Grow()
+{
+	Set.emplace_back(new C4MassMover[C4MassMoverChunk]);
+	for (int32_t cnt=0; cnt<C4MassMoverChunk; cnt++) Set.back()[cnt].Mat=MNone;
+	Active.resize((GetSize() + 63) / 64, 0);
+}
+
+void C4MassMoverSet::SetActive(int32_t idx, bool fActive)
+{
+	if (fActive)
+		Active[idx / 64] |= uint64_t(1) << (idx % 64);
+	else
+		Active[idx / 64] &= ~(uint64_t(1) << (idx % 64));
+}
+
+int32_t C4MassMoverSet::GetLastActive(int32_t idx) const
+{
+	if (idx < 0) return -1;
+	int32_t iWord = idx / 64;
+	// Mask out the slots above idx in the first word
+	uint64_t iBits = Active[iWord] & (~uint64_t(0) >> (63 - idx % 64));
+	while (!iBits)
+	{
+		if (--iWord < 0) return -1;
+		iBits = Active[iWord];
+	}
+	int32_t iBit = 63;
+	while (!(iBits & (uint64_t(1) << iBit))) iBit--;
+	return iWord * 64 + iBit;
+}
+
+void C4MassMoverSet::UpdateActive()
+{
+	std::fill(Active.begin(), Active.end(), 0);
+	for (int32_t cnt=0; cnt<GetSize(); cnt++)
+		if (Get(cnt).Mat!=MNone)
+			SetActive(cnt, true);
+}
+
 void C4MassMoverSet::Draw()
 {
 }
@@ -105,8 +152,9 @@ bool C4MassMover::Init(int32_t tx, int32_t ty)
 	// Check mat
 	Mat=GBackMat(tx,ty);
 	x=tx; y=ty;
+	if (Mat==MNone) return false;
 	::MassMover.Count++;
-	return (Mat!=MNone);
+	return true;
 }
 
 void C4MassMover::Cease()
@@ -182,8 +230,8 @@ bool C4MassMover::Corrosion(int32_t dx, int32_t dy)
 
 void C4MassMoverSet::Default()
 {
-	int32_t cnt;
-	for (cnt=0; cnt<C4MassMoverChunk; cnt++) Set[cnt].Mat=MNone;
+	Set.clear(); Active.clear();
+	Grow();
 	Count=0;
 	CreatePtr=0;
 }
@@ -195,8 +243,8 @@ bool C4MassMoverSet::Save(C4Group &hGroup)
 	Consolidate();
 	// Recount
 	Count=0;
-	for (cnt=0; cnt<C4MassMoverChunk; cnt++)
-		if (Set[cnt].Mat!=MNone)
+	for (cnt=0; cnt<GetSize(); cnt++)
+		if (Get(cnt).Mat!=MNone)
 			Count++;
 	// All empty: delete component
 	if (!Count)
@@ -204,8 +252,11 @@ bool C4MassMoverSet::Save(C4Group &hGroup)
 		hGroup.Delete(C4CFN_MassMover);
 		return true;
 	}
-	// Save set
-	if (!hGroup.Add(C4CFN_MassMover,Set,Count*sizeof(C4MassMover)))
+	// Save set; after consolidation, all movers are at the start
+	StdBuf Buf; Buf.New(Count*sizeof(C4MassMover));
+	for (cnt=0; cnt<Count; cnt++)
+		Buf.Write(&Get(cnt), sizeof(C4MassMover), cnt*sizeof(C4MassMover));
+	if (!hGroup.Add(C4CFN_MassMover,Buf,false,true))
 		return false;
 	// Success
 	return true;
@@ -220,7 +271,10 @@ bool C4MassMoverSet::Load(C4Group &hGroup)
 	if ((iBinSize % iMoverSize)!=0) return false;
 	// load new
 	Count = iBinSize / iMoverSize;
-	if (!hGroup.Read(Set,iBinSize)) return false;
+	while (GetSize() < Count) Grow();
+	for (int32_t cnt=0; cnt<Count; cnt++)
+		if (!hGroup.Read(&Get(cnt), iMoverSize)) return false;
+	UpdateActive();
 	return true;
 }
 
@@ -228,10 +282,10 @@ void C4MassMoverSet::Consolidate()
 {
 	// Consolidate set
 	int32_t iSpot,iPtr,iConsolidated;
-	for (iSpot=-1,iPtr=0,iConsolidated=0; iPtr<C4MassMoverChunk; iPtr++)
+	for (iSpot=-1,iPtr=0,iConsolidated=0; iPtr<GetSize(); iPtr++)
 	{
 		// Empty: set new spot if needed
-		if (Set[iPtr].Mat==MNone)
+		if (Get(iPtr).Mat==MNone)
 		{
 			if (iSpot==-1) iSpot=iPtr;
 		}
@@ -239,17 +293,23 @@ void C4MassMoverSet::Consolidate()
 		else if (iSpot!=-1)
 		{
 			// Move to spot
-			Set[iSpot]=Set[iPtr];
-			Set[iPtr].Mat=MNone;
+			Get(iSpot)=Get(iPtr);
+			Get(iPtr).Mat=MNone;
 			iConsolidated++;
 			// Advance empty spot (as far as ptr)
 			for (; iSpot<iPtr; iSpot++)
-				if (Set[iSpot].Mat==MNone)
+				if (Get(iSpot).Mat==MNone)
 					break;
 			// No empty spot below ptr
 			if (iSpot==iPtr) iSpot=-1;
 		}
 	}
+	UpdateActive();
+	// Release chunks that are no longer needed
+	int32_t iLast = GetLastActive(GetSize()-1);
+	while (Set.size() > 1 && iLast < GetSize() - C4MassMoverChunk)
+		Set.pop_back();
+	Active.resize((GetSize() + 63) / 64);
 	// Reset create ptr
 	CreatePtr=0;
 }
@@ -262,9 +322,12 @@ void C4MassMoverSet::Synchronize()
 void C4MassMoverSet::Copy(C4MassMoverSet &rSet)
 {
 	Clear();
+	Set.clear();
+	while (GetSize() < rSet.GetSize()) Grow();
 	Count=rSet.Count;
 	CreatePtr=rSet.CreatePtr;
-	for (int32_t cnt=0; cnt<C4MassMoverChunk; cnt++) Set[cnt]=rSet.Set[cnt];
+	for (int32_t cnt=0; cnt<GetSize(); cnt++) Get(cnt)=rSet.Get(cnt);
+	Active=rSet.Active;
 }
 
 C4MassMoverSet MassMover;
@@ -20,7 +20,7 @@
 #ifndef INC_C4MassMover
 #define INC_C4MassMover
 
-const int32_t C4MassMoverChunk = 10000;
+const int32_t C4MassMoverChunk = 10000; // movers per allocation; the set grows by whole chunks
 
 class C4MassMover
 {
@@ -43,7 +43,9 @@ public:
 	int32_t Count;
 	int32_t CreatePtr;
 protected:
-	C4MassMover Set[C4MassMoverChunk];
+	// Chunks are never moved, so movers stay in place while the set grows during execution
+	std::vector<std::unique_ptr<C4MassMover[]>> Set;
+	std::vector<uint64_t> Active; // one bit per slot that holds a mover
 public:
 	void Copy(C4MassMoverSet &rSet);
 	void Synchronize();
@@ -56,6 +58,12 @@ public:
 	bool Save(C4Group &hGroup);
 protected:
 	void Consolidate();
+	void Grow();
+	int32_t GetSize() const { return Set.size() * C4MassMoverChunk; }
+	C4MassMover &Get(int32_t idx) { return Set[idx / C4MassMoverChunk][idx % C4MassMoverChunk]; }
+	void SetActive(int32_t idx, bool fActive);
+	int32_t GetLastActive(int32_t idx) const; // highest slot at or below idx that holds a mover; -1 if none
+	void UpdateActive();
 };
 
 extern C4MassMoverSet MassMover;
@@ -30,8 +30,11 @@
 
 static const C4Real WindDrift_Factor = itofix(1, 800);
 
-bool C4PXS::Execute()
+bool C4PXSSystem::Execute(size_t i)
 {
+	// Work on copies: reactions may create new PXS and thereby move the arrays
+	int32_t Mat = this->Mat[i];
+	C4Real x = X[i], y = Y[i], xdir = XDir[i], ydir = YDir[i];
 	if (DEBUGREC_PXS && Config.General.DebugRec)
 	{
 		C4RCExecPXS rc;
@@ -43,18 +46,18 @@ bool C4PXS::Execute()
 
 	// Safety
 	if (!MatValid(Mat))
-		{ Deactivate(); return false; }
+		{ Deactivate(i); return false; }
 
 	// Out of bounds
 	if ((x<0) || (x>=::Landscape.GetWidth()) || (y<-10) || (y>=::Landscape.GetHeight()))
-		{ Deactivate(); return false; }
+		{ Deactivate(i); return false; }
 
 	// Material conversion
 	int32_t iX = fixtoi(x), iY = fixtoi(y);
 	inmat=GBackMat(iX,iY);
 	C4MaterialReaction *pReact = ::MaterialMap.GetReactionUnsafe(Mat, inmat);
 	if (pReact && (*pReact->pFunc)(pReact, iX,iY, iX,iY, xdir,ydir, Mat,inmat, meePXSPos, nullptr))
-		{ Deactivate(); return false; }
+		{ Deactivate(i); return false; }
 
 	// Gravity
 	ydir+=GravAccel;
@@ -82,7 +85,7 @@ bool C4PXS::Execute()
 		// Check path
 		if (::Landscape._PathFree(iX, iY, iToX, iToY))
 		{
-			x=ctcox; y=ctcoy;
+			this->Mat[i]=Mat; X[i]=ctcox; Y[i]=ctcoy; XDir[i]=xdir; YDir[i]=ydir;
 			return true;
 		}
 
@@ -101,7 +104,7 @@ bool C4PXS::Execute()
 			if ((*pReact->pFunc)(pReact, iX,iY, inX,inY, xdir,ydir, Mat,inmat, meePXSMove, &fStopMovement))
 			{
 				// destructive contact
-				Deactivate();
+				Deactivate(i);
 				return false;
 			}
 			else
@@ -112,6 +115,7 @@ bool C4PXS::Execute()
 					// But keep fractional positions to allow proper movement on moving ground
 					if (iX != iX0) x = itofix(iX);
 					if (iY != iY0) y = itofix(iY);
+					this->Mat[i]=Mat; X[i]=x; Y[i]=y; XDir[i]=xdir; YDir[i]=ydir;
 					return true;
 				}
 				// there was a reaction func, but it didn't do anything - continue movement
@@ -122,27 +126,44 @@ bool C4PXS::Execute()
 	while (iX != iToX || iY != iToY);
 
 	// No contact? Free movement
-	x=ctcox; y=ctcoy;
+	this->Mat[i]=Mat; X[i]=ctcox; Y[i]=ctcoy; XDir[i]=xdir; YDir[i]=ydir;
 	if (DEBUGREC_PXS && Config.General.DebugRec)
 	{
 		C4RCExecPXS rc;
-		rc.x=x; rc.y=y; rc.iMat=Mat;
+		rc.x=ctcox; rc.y=ctcoy; rc.iMat=Mat;
 		rc.pos = 1;
 		AddDbgRec(RCT_ExecPXS, &rc, sizeof(rc));
 	}
 	return true;
 }
 
-void C4PXS::Deactivate()
+void C4PXSSystem::Deactivate(size_t i)
 {
 	if (DEBUGREC_PXS && Config.General.DebugRec)
 	{
 		C4RCExecPXS rc;
-		rc.x=x; rc.y=y; rc.iMat=Mat;
+		rc.x=X[i]; rc.y=Y[i]; rc.iMat=Mat[i];
 		rc.pos = 2;
 		AddDbgRec(RCT_ExecPXS, &rc, sizeof(rc));
 	}
-	Mat=MNone;
+	Mat[i]=MNone;
+}
+
+void C4PXSSystem::Remove(size_t i)
+{
+	--Count;
+	Mat[i] = Mat[Count];
+	X[i] = X[Count]; Y[i] = Y[Count];
+	XDir[i] = XDir[Count]; YDir[i] = YDir[Count];
+	Resize(Count);
+}
+
+void C4PXSSystem::Resize(size_t iCount)
+{
+	Mat.resize(iCount, MNone);
+	X.resize(iCount, Fix0); Y.resize(iCount, Fix0);
+	XDir.resize(iCount, Fix0); YDir.resize(iCount, Fix0);
+	Count = iCount;
 }
 
 C4PXSSystem::C4PXSSystem()
@@ -157,40 +178,37 @@ C4PXSSystem::~C4PXSSystem()
 
 void C4PXSSystem::Default()
 {
-	Count=0;
+	Resize(0);
 }
 
 void C4PXSSystem::Clear()
 {
-	Count=0;
-}
-
-C4PXS* C4PXSSystem::New()
-{
-	if (Count < PXSMax)
-		return &PXS[Count++];
-	return nullptr;
+	Resize(0);
+	Mat.shrink_to_fit();
+	X.shrink_to_fit(); Y.shrink_to_fit();
+	XDir.shrink_to_fit(); YDir.shrink_to_fit();
 }
 
 bool C4PXSSystem::Create(int32_t mat, C4Real ix, C4Real iy, C4Real ixdir, C4Real iydir)
 {
-	C4PXS *pxp;
 	if (!MatValid(mat)) return false;
-	if (!(pxp=New())) return false;
-	pxp->Mat=mat;
-	pxp->x=ix; pxp->y=iy;
-	pxp->xdir=ixdir; pxp->ydir=iydir;
+	if (Count >= PXSMax) return false;
+	Mat.push_back(mat);
+	X.push_back(ix); Y.push_back(iy);
+	XDir.push_back(ixdir); YDir.push_back(iydir);
+	++Count;
 	return true;
 }
 
 void C4PXSSystem::Execute()
 {
+	// PXS created during execution are appended and moved in the same frame
 	for (size_t i = 0; i < Count; i++)
 	{
-		if (!PXS[i].Execute())
+		if (!Execute(i))
 		{
-			assert(PXS[i].Mat == MNone);
-			PXS[i--] = PXS[--Count];
+			assert(Mat[i] == MNone);
+			Remove(i--);
 		}
 	}
 }
@@ -213,11 +231,10 @@ void C4PXSSystem::Draw(C4TargetFacet &cgo)
 	// First pass: draw simple PXS (lines/pixels)
 	for (size_t i = 0; i < Count; i++)
 	{
-		C4PXS *pxp = &PXS[i];
-		if (pxp->Mat != MNone && VisibleRect.Contains(fixtoi(pxp->x), fixtoi(pxp->y)))
+		if (Mat[i] != MNone && VisibleRect.Contains(fixtoi(X[i]), fixtoi(Y[i])))
 		{
-			C4Material *pMat = &::MaterialMap.Map[pxp->Mat];
-			const DWORD dwMatClr = ::Landscape.GetPal()->GetClr((BYTE) (Mat2PixColDefault(pxp->Mat)));
+			C4Material *pMat = &::MaterialMap.Map[Mat[i]];
+			const DWORD dwMatClr = ::Landscape.GetPal()->GetClr((BYTE) (Mat2PixColDefault(Mat[i])));
 			if(pMat->PXSFace.Surface)
 			{
 				int32_t pnx, pny;
@@ -231,8 +248,8 @@ void C4PXSSystem::Draw(C4TargetFacet &cgo)
 
 				const float w = z;
 				const float h = z * fcHgt / fcWdt;
-				const float x1 = fixtof(pxp->x) + cgox + z * pMat->PXSGfxRt.tx / fcWdt;
-				const float y1 = fixtof(pxp->y) + cgoy + z * pMat->PXSGfxRt.ty / fcHgt;
+				const float x1 = fixtof(X[i]) + cgox + z * pMat->PXSGfxRt.tx / fcWdt;
+				const float y1 = fixtof(Y[i]) + cgoy + z * pMat->PXSGfxRt.ty / fcHgt;
 				const float x2 = x1 + w;
 				const float y2 = y1 + h;
 
@@ -255,7 +272,7 @@ void C4PXSSystem::Draw(C4TargetFacet &cgo)
 				vtx[4] = vtx[2];
 				vtx[5] = vtx[0];
 
-				std::vector<C4BltVertex>& vec = bltVtx[pxp->Mat];
+				std::vector<C4BltVertex>& vec = bltVtx[Mat[i]];
 				vec.push_back(vtx[0]);
 				vec.push_back(vtx[1]);
 				vec.push_back(vtx[2]);
@@ -266,14 +283,14 @@ void C4PXSSystem::Draw(C4TargetFacet &cgo)
 			else
 			{
 				// old-style: unicolored pixels or lines
-				if (fixtoi(pxp->xdir) || fixtoi(pxp->ydir))
+				if (fixtoi(XDir[i]) || fixtoi(YDir[i]))
 				{
 					// lines for stuff that goes whooosh!
-					int len = fixtoi(Abs(pxp->xdir) + Abs(pxp->ydir));
+					int len = fixtoi(Abs(XDir[i]) + Abs(YDir[i]));
 					const DWORD dwMatClrLen = uint32_t(std::max<int>(dwMatClr >> 24, 195 - (195 - (dwMatClr >> 24)) / len)) << 24 | (dwMatClr & 0xffffff);
 					C4BltVertex begin, end;
-					begin.ftx = fixtof(pxp->x - pxp->xdir) + cgox; begin.fty = fixtof(pxp->y - pxp->ydir) + cgoy;
-					end.ftx = fixtof(pxp->x) + cgox; end.fty = fixtof(pxp->y) + cgoy;
+					begin.ftx = fixtof(X[i] - XDir[i]) + cgox; begin.fty = fixtof(Y[i] - YDir[i]) + cgoy;
+					end.ftx = fixtof(X[i]) + cgox; end.fty = fixtof(Y[i]) + cgoy;
 					DwTo4UB(dwMatClrLen, begin.color);
 					DwTo4UB(dwMatClrLen, end.color);
 					lineVtx.push_back(begin);
@@ -283,8 +300,8 @@ void C4PXSSystem::Draw(C4TargetFacet &cgo)
 				{
 					// single pixels for slow stuff
 					C4BltVertex vtx;
-					vtx.ftx = fixtof(pxp->x) + cgox;
-					vtx.fty = fixtof(pxp->y) + cgoy;
+					vtx.ftx = fixtof(X[i]) + cgox;
+					vtx.fty = fixtof(Y[i]) + cgoy;
 					DwTo4UB(dwMatClr, vtx.color);
 					pixVtx.push_back(vtx);
 				}
@@ -341,7 +358,15 @@ bool C4PXSSystem::Save(C4Group &hGroup)
 #endif
 	if (!hTempFile.Write(&iNumFormat, sizeof (iNumFormat)))
 		return false;
-	if (!hTempFile.Write(PXS, Count * sizeof(C4PXS)))
+	// The file keeps the record layout of C4PXS
+	std::vector<C4PXS> Records(Count);
+	for (size_t i = 0; i < Count; i++)
+	{
+		Records[i].Mat = Mat[i];
+		Records[i].x = X[i]; Records[i].y = Y[i];
+		Records[i].xdir = XDir[i]; Records[i].ydir = YDir[i];
+	}
+	if (!hTempFile.Write(Records.data(), Count * sizeof(C4PXS)))
 		return false;
 
 	if (!hTempFile.Close())
@@ -375,13 +400,14 @@ bool C4PXSSystem::Load(C4Group &hGroup)
 	// calc chunk count
 	PXSNum = iBinSize / sizeof(C4PXS);
 	if (PXSNum > PXSMax) return false;
-	if (!hGroup.Read(PXS, iBinSize)) return false;
+	std::vector<C4PXS> Records(PXSNum);
+	if (PXSNum && !hGroup.Read(Records.data(), iBinSize)) return false;
 	// count the PXS, Peter!
-	Count = PXSNum;
+	Resize(PXSNum);
 	// convert num format, if neccessary
 	for (size_t i = 0; i < Count; i++)
 	{
-		C4PXS *pxp = &PXS[i];
+		C4PXS *pxp = &Records[i];
 		if (pxp->Mat != MNone)
 		{
 			// convert number format
@@ -391,6 +417,9 @@ bool C4PXSSystem::Load(C4Group &hGroup)
 			if (iNumForm == 1) { FIXED_TO_FLOAT(&pxp->x); FIXED_TO_FLOAT(&pxp->y); FIXED_TO_FLOAT(&pxp->xdir); FIXED_TO_FLOAT(&pxp->ydir); }
 #endif
 		}
+		Mat[i] = pxp->Mat;
+		X[i] = pxp->x; Y[i] = pxp->y;
+		XDir[i] = pxp->xdir; YDir[i] = pxp->ydir;
 	}
 	return true;
 }
@@ -401,7 +430,7 @@ int32_t C4PXSSystem::GetCount(int32_t mat) const
 	int32_t result = 0;
 	for (size_t i = 0; i < Count; i++)
 	{
-		if (PXS[i].Mat == mat) ++result;
+		if (Mat[i] == mat) ++result;
 	}
 	return result;
 }
@@ -412,9 +441,8 @@ int32_t C4PXSSystem::GetCount(int32_t mat, int32_t x, int32_t y, int32_t wdt, in
 	int32_t result = 0;
 	for (size_t i = 0; i < Count; i++)
 	{
-		const C4PXS *pxp = &PXS[i];
-		if (pxp->Mat == mat || mat == MNone)
-			if (Inside(pxp->x, x, x + wdt - 1) && Inside(pxp->y, y, y + hgt - 1))
+		if (Mat[i] == mat || mat == MNone)
+			if (Inside(X[i], x, x + wdt - 1) && Inside(Y[i], y, y + hgt - 1))
 				++result;
 	}
 	return result;
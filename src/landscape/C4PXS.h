@@ -22,18 +22,16 @@
 
 #include "landscape/C4Material.h"
 
+// Saved form of a single pixel sprite
 class C4PXS
 {
-	friend class C4PXSSystem;
-protected:
+public:
 	int32_t Mat{MNone};
 	C4Real x{Fix0}, y{Fix0}, xdir{Fix0}, ydir{Fix0};
-protected:
-	bool Execute();
-	void Deactivate();
 };
 
-const size_t PXSMax = 10000;
+// Upper limit, so runaway scripts cannot use up all memory
+const size_t PXSMax = 200000;
 
 class C4PXSSystem
 {
@@ -43,7 +41,9 @@ public:
 public:
 	size_t Count;
 protected:
-	C4PXS PXS[PXSMax];
+	// Stored as separate arrays, so loops over positions only touch the data they need
+	std::vector<int32_t> Mat;
+	std::vector<C4Real> X, Y, XDir, YDir;
 public:
 	void Default();
 	void Clear();
@@ -57,7 +57,10 @@ public:
 	int32_t GetCount(int32_t mat) const; // count PXS of given material
 	int32_t GetCount(int32_t mat, int32_t x, int32_t y, int32_t wdt, int32_t hgt) const; // count PXS of given material in given area. mat==-1 for all materials.
 protected:
-	C4PXS *New();
+	bool Execute(size_t i); // move a single PXS; returns false if it was deactivated
+	void Deactivate(size_t i);
+	void Remove(size_t i); // moves the last PXS into the gap
+	void Resize(size_t iCount);
 };
 
 extern C4PXSSystem PXS;
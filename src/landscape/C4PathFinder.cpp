@@ -104,6 +104,7 @@ protected:
 	bool PointFree(int32_t iX, int32_t iY);
 	bool Crawl();
 	bool PathFree(int32_t &rX, int32_t &rY, int32_t iToX, int32_t iToY, C4TransferZone **ppZone = nullptr);
+	static C4TransferZone *FindZone(const std::vector<C4TransferZone *> &rZones, int32_t iX, int32_t iY); // first of the zones containing the point
 };
 
 C4PathFinderRay::C4PathFinderRay()
@@ -315,6 +316,15 @@ void C4PathFinderRay::Draw(C4TargetFacet &cgo)
 bool C4PathFinderRay::PathFree(int32_t &rX, int32_t &rY, int32_t iToX, int32_t iToY, C4TransferZone **ppZone)
 {
 	int32_t d,dx,dy,aincr,bincr,xincr,yincr,x,y;
+	// Only zones near the path need to be checked for every point
+	std::vector<C4TransferZone *> *pZones = nullptr;
+	if (ppZone)
+		if (pPathFinder->TransferZonesEnabled)
+			if (pPathFinder->TransferZones)
+			{
+				pZones = &pPathFinder->PathZones;
+				pPathFinder->TransferZones->FindInRect(C4Rect(std::min(rX,iToX),std::min(rY,iToY),Abs(iToX-rX)+1,Abs(iToY-rY)+1), *pZones);
+			}
 	// Y based
 	if (Abs(iToX-rX)<Abs(iToY-rY))
 	{
@@ -327,11 +337,9 @@ bool C4PathFinderRay::PathFree(int32_t &rX, int32_t &rY, int32_t iToX, int32_t i
 			if (PointFree(x,y)) { rY=y; rX=x; }
 			else return false;
 			// Check transfer zone intersection
-			if (ppZone)
-				if (pPathFinder->TransferZonesEnabled)
-					if (pPathFinder->TransferZones)
-						if ((*ppZone = pPathFinder->TransferZones->Find(rX,rY)))
-							return false;
+			if (pZones)
+				if ((*ppZone = FindZone(*pZones,rX,rY)))
+					return false;
 			// Advance
 			if (d>=0) { x+=xincr; d+=aincr; }
 			else d+=bincr;
@@ -349,11 +357,9 @@ bool C4PathFinderRay::PathFree(int32_t &rX, int32_t &rY, int32_t iToX, int32_t i
 			if (PointFree(x,y)) { rY=y; rX=x; }
 			else return false;
 			// Check transfer zone intersection
-			if (ppZone)
-				if (pPathFinder->TransferZonesEnabled)
-					if (pPathFinder->TransferZones)
-						if ((*ppZone = pPathFinder->TransferZones->Find(rX,rY)))
-							return false;
+			if (pZones)
+				if ((*ppZone = FindZone(*pZones,rX,rY)))
+					return false;
 			// Advance
 			if (d>=0) { y+=yincr; d+=aincr; }
 			else d+=bincr;
@@ -421,6 +427,14 @@ void C4PathFinderRay::SetCompletePath()
 	}
 }
 
+C4TransferZone *C4PathFinderRay::FindZone(const std::vector<C4TransferZone *> &rZones, int32_t iX, int32_t iY)
+{
+	for (C4TransferZone *pZone : rZones)
+		if (pZone->At(iX,iY))
+			return pZone;
+	return nullptr;
+}
+
 bool C4PathFinderRay::PointFree(int32_t iX, int32_t iY)
 {
 	return pPathFinder->PointFree(iX,iY);
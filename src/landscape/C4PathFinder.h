@@ -53,6 +53,7 @@ private:
 	C4PathFinderRay *FirstRay;
 	bool Success;
 	C4TransferZones *TransferZones;
+	std::vector<C4TransferZone *> PathZones; // zones near the path currently checked by a ray
 	bool TransferZonesEnabled;
 	int Level;
 };
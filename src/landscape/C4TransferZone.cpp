@@ -49,6 +49,7 @@ C4TransferZones::~C4TransferZones()
 void C4TransferZones::Default()
 {
 	First=nullptr;
+	BoundsValid=false;
 }
 
 void C4TransferZones::Clear()
@@ -56,6 +57,7 @@ void C4TransferZones::Clear()
 	C4TransferZone *pZone,*pNext;
 	for (pZone=First; pZone; pZone=pNext) { pNext=pZone->Next; delete pZone; }
 	First=nullptr;
+	BoundsValid=false;
 }
 
 void C4TransferZones::ClearPointers(C4Object *pObj)
@@ -78,6 +80,7 @@ bool C4TransferZones::Set(int32_t iX, int32_t iY, int32_t iWdt, int32_t iHgt, C4
 	{
 		pZone->X=iX; pZone->Y=iY;
 		pZone->Wdt=iWdt; pZone->Hgt=iHgt;
+		BoundsValid=false;
 	}
 	// Allocate and add new zone
 	else
@@ -96,6 +99,7 @@ bool C4TransferZones::Add(int32_t iX, int32_t iY, int32_t iWdt, int32_t iHgt, C4
 	pZone->Object=pObj;
 	pZone->Next=First;
 	First=pZone;
+	BoundsValid=false;
 	// Success
 	return true;
 }
@@ -108,6 +112,8 @@ void C4TransferZones::Synchronize()
 
 C4TransferZone* C4TransferZones::Find(int32_t iX, int32_t iY)
 {
+	if (!BoundsValid) UpdateBounds();
+	if (!Bounds.Contains(iX,iY)) return nullptr;
 	for (C4TransferZone *pZone=First; pZone; pZone=pZone->Next)
 		if (Inside<int32_t>(iX-pZone->X,0,pZone->Wdt-1))
 			if (Inside<int32_t>(iY-pZone->Y,0,pZone->Hgt-1))
@@ -115,6 +121,25 @@ C4TransferZone* C4TransferZones::Find(int32_t iX, int32_t iY)
 	return nullptr;
 }
 
+void C4TransferZones::FindInRect(const C4Rect &rRect, std::vector<C4TransferZone *> &rZones)
+{
+	rZones.clear();
+	for (C4TransferZone *pZone=First; pZone; pZone=pZone->Next)
+		if (pZone->X < rRect.x+rRect.Wdt && pZone->X+pZone->Wdt > rRect.x)
+			if (pZone->Y < rRect.y+rRect.Hgt && pZone->Y+pZone->Hgt > rRect.y)
+				rZones.push_back(pZone);
+}
+
+void C4TransferZones::UpdateBounds()
+{
+	Bounds.Default();
+	for (C4TransferZone *pZone=First; pZone; pZone=pZone->Next)
+		// Zones without extent never contain a point
+		if (pZone->Wdt>0 && pZone->Hgt>0)
+			Bounds.Add(C4Rect(pZone->X,pZone->Y,pZone->Wdt,pZone->Hgt));
+	BoundsValid=true;
+}
+
 void C4TransferZones::Draw(C4TargetFacet &cgo)
 {
 	for (C4TransferZone *pZone=First; pZone; pZone=pZone->Next)
@@ -144,6 +169,7 @@ int32_t C4TransferZones::RemoveNullZones()
 		pNext=pZone->Next;
 		if (!pZone->Object)
 		{
+			BoundsValid=false;
 			delete pZone;
 			if (pPrev) pPrev->Next=pNext;
 			else First=pNext;
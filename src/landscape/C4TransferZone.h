@@ -20,6 +20,8 @@
 #ifndef INC_C4TransferZone
 #define INC_C4TransferZone
 
+#include "lib/C4Rect.h"
+
 class C4TransferZone
 {
 	friend class C4TransferZones;
@@ -45,7 +47,10 @@ public:
 	~C4TransferZones();
 protected:
 	int32_t RemoveNullZones();
+	void UpdateBounds();
 	C4TransferZone *First;
+	C4Rect Bounds; // union of all zones, so most points can be rejected without walking the list
+	bool BoundsValid;
 public:
 	void Default();
 	void Clear();
@@ -55,6 +60,7 @@ public:
 	void Synchronize();
 	C4TransferZone* Find(C4Object *pObj);
 	C4TransferZone* Find(int32_t iX, int32_t iY);
+	void FindInRect(const C4Rect &rRect, std::vector<C4TransferZone *> &rZones); // all zones overlapping the rect, in list order
 	bool Add(int32_t iX, int32_t iY, int32_t iWdt, int32_t iHgt, C4Object *pObj);
 	bool Set(int32_t iX, int32_t iY, int32_t iWdt, int32_t iHgt, C4Object *pObj);
 };
@@ -132,9 +132,9 @@ void C4MainStat::Show()
 
 		// output it!
 		if (pAkt->iCount)
-			LogSilentF("%s: n = %u, t = %u, td = %.2f",
-			           pAkt->strName, pAkt->iCount, pAkt->tTimeSum,
-			           double(pAkt->tTimeSum) / pAkt->iCount * 1000);
+			LogSilentF("%s: n = %u, t = %lluus, td = %.2fus",
+			           pAkt->strName, pAkt->iCount, (unsigned long long) pAkt->tTimeSum,
+			           double(pAkt->tTimeSum) / pAkt->iCount);
 	}
 
 	// delete...
@@ -153,12 +153,23 @@ void C4MainStat::ShowPart(int FrameCounter)
 
 	// insert all stats
 	for (pAkt = pFirst; pAkt; pAkt = pAkt->pNext)
-		LogSilentF("%s: n=%u, t=%u", pAkt->strName, pAkt->iCountPart, pAkt->tTimeSumPart);
+		LogSilentF("%s: n=%u, t=%lluus", pAkt->strName, pAkt->iCountPart, (unsigned long long) pAkt->tTimeSumPart);
 
 	// insert part stat end idtf
 	LogSilentF("** PartStat end\n");
 }
 
+void C4MainStat::AppendJSON(StdStrBuf &Buf) const
+{
+	Buf.Append("[");
+	for (C4Stat* pAkt = pFirst; pAkt; pAkt = pAkt->pNext)
+	{
+		Buf.AppendFormat("\n\t\t{\"name\": \"%s\", \"count\": %u, \"time_us\": %llu}%s",
+		                 pAkt->strName, pAkt->iCount, (unsigned long long) pAkt->tTimeSum, pAkt->pNext ? "," : "");
+	}
+	Buf.Append(pFirst ? "\n\t]" : "]");
+}
+
 // ** implemetation of C4Stat
 
 C4Stat::C4Stat(const char* strnName)
@@ -17,6 +17,8 @@
 #ifndef INC_C4Stat
 #define INC_C4Stat
 
+#include <chrono>
+
 class C4Stat;
 
 // *** main statistic class
@@ -31,6 +33,7 @@ public:
 
 	void Show();
 	void ShowPart(int FrameCounter);
+	void AppendJSON(StdStrBuf &Buf) const; // append all statistics as JSON array of counts and total microseconds
 
 	void Reset();
 	void ResetPart();
@@ -57,7 +60,7 @@ public:
 	inline void Start()
 	{
 		if (!iStartCalled)
-			tStartTime = C4TimeMilliseconds::Now();
+			tStartTime = std::chrono::steady_clock::now();
 		iCount ++;
 		iCountPart ++;
 		iStartCalled ++;
@@ -67,9 +70,9 @@ public:
 	{
 		assert(iStartCalled);
 		iStartCalled --;
-		if (!iStartCalled && iCount >= 100)
+		if (!iStartCalled)
 		{
-			uint32_t tTime = C4TimeMilliseconds::Now() - tStartTime;
+			uint64_t tTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tStartTime).count();
 
 			tTimeSum += tTime;
 			tTimeSumPart += tTime;
@@ -87,7 +90,7 @@ protected:
 	C4Stat* pNext;
 	C4Stat* pPrev;
 
-	C4TimeMilliseconds tStartTime;
+	std::chrono::steady_clock::time_point tStartTime;
 
 	// start-call depth
 	unsigned int iStartCalled;
@@ -95,16 +98,16 @@ protected:
 
 	// ** statistic data
 
-	// sum of times
-	uint32_t tTimeSum;
+	// sum of times in microseconds
+	uint64_t tTimeSum;
 
 	// number of starts called
 	unsigned int iCount;
 
 	// ** statistic data (partial stat)
 
-	// sum of times
-	uint32_t tTimeSumPart;
+	// sum of times in microseconds
+	uint64_t tTimeSumPart;
 
 	// number of starts called
 	unsigned int iCountPart;
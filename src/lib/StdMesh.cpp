@@ -288,47 +288,59 @@ namespace
 
 StdMeshTransformation StdMeshTrack::GetTransformAt(float time, float length) const
 {
-	std::map<float, StdMeshKeyFrame>::const_iterator iter = Frames.lower_bound(time);
+	size_t iter = std::lower_bound(Times.begin(), Times.end(), time) - Times.begin();
 
 	// We are at or before the first keyframe. This short typically not
 	// happen, since all animations have a keyframe 0. Simply return the
 	// first keyframe.
-	if (iter == Frames.begin())
-		return iter->second.Transformation;
+	if (iter == 0)
+		return Frames[0].Transformation;
 
-	std::map<float, StdMeshKeyFrame>::const_iterator prev_iter = iter;
-	--prev_iter;
+	size_t prev_iter = iter - 1;
 
 	float iter_pos;
-	if (iter == Frames.end())
+	if (iter == Times.size())
 	{
 		// We are beyond the last keyframe.
 		// Interpolate between the last and the first keyframe.
 		// See also bug #1406.
-		iter = Frames.begin();
+		iter = 0;
 		iter_pos = length;
 	}
 	else
 	{
-		iter_pos = iter->first;
+		iter_pos = Times[iter];
 	}
 
 	// No two keyframes with the same position:
-	assert(iter_pos > prev_iter->first);
+	assert(iter_pos > Times[prev_iter]);
 
 	// Requested position is between the two selected keyframes:
-	assert(time >= prev_iter->first);
+	assert(time >= Times[prev_iter]);
 	assert(iter_pos >= time);
 
-	float dt = iter_pos - prev_iter->first;
-	float weight1 = (time - prev_iter->first) / dt;
+	float dt = iter_pos - Times[prev_iter];
+	float weight1 = (time - Times[prev_iter]) / dt;
 	float weight2 = (iter_pos - time) / dt;
 	(void)weight2; // used in assertion only
 
 	assert(weight1 >= 0 && weight2 >= 0 && weight1 <= 1 && weight2 <= 1);
 	assert(fabs(weight1 + weight2 - 1) < 1e-6);
 
-	return StdMeshTransformation::Nlerp(prev_iter->second.Transformation, iter->second.Transformation, weight1);
+	return StdMeshTransformation::Nlerp(Frames[prev_iter].Transformation, Frames[iter].Transformation, weight1);
+}
+
+StdMeshKeyFrame &StdMeshTrack::AddFrame(float time)
+{
+	// Keyframes are usually added in order, so this normally appends
+	std::vector<float>::iterator iter = std::lower_bound(Times.begin(), Times.end(), time);
+	size_t pos = iter - Times.begin();
+	if (iter == Times.end() || *iter != time)
+	{
+		Times.insert(iter, time);
+		Frames.insert(Frames.begin() + pos, StdMeshKeyFrame());
+	}
+	return Frames[pos];
 }
 
 StdMeshAnimation::StdMeshAnimation(const StdMeshAnimation& other):
@@ -447,11 +459,11 @@ void StdMeshSkeleton::MirrorAnimation(const StdMeshAnimation& animation)
 				// Mirror all the keyframes of both tracks
 				if (new_anim.Tracks[i] != nullptr)
 					for (auto & Frame : new_anim.Tracks[i]->Frames)
-						MirrorKeyFrame(Frame.second, own_trans, StdMeshTransformation::Inverse(other_own_trans));
+						MirrorKeyFrame(Frame, own_trans, StdMeshTransformation::Inverse(other_own_trans));
 
 				if (new_anim.Tracks[other_bone->Index] != nullptr)
 					for (auto & Frame : new_anim.Tracks[other_bone->Index]->Frames)
-						MirrorKeyFrame(Frame.second, other_own_trans, StdMeshTransformation::Inverse(own_trans));
+						MirrorKeyFrame(Frame, other_own_trans, StdMeshTransformation::Inverse(own_trans));
 			}
 		}
 		else if (bone.Name.Compare_(".N", bone.Name.getLength() - 2) != 0)
@@ -462,7 +474,7 @@ void StdMeshSkeleton::MirrorAnimation(const StdMeshAnimation& animation)
 				if (bone.GetParent()) own_trans = bone.GetParent()->InverseTransformation * bone.Transformation;
 
 				for (auto & Frame : new_anim.Tracks[i]->Frames)
-					MirrorKeyFrame(Frame.second, own_trans, StdMeshTransformation::Inverse(own_trans));
+					MirrorKeyFrame(Frame, own_trans, StdMeshTransformation::Inverse(own_trans));
 			}
 		}
 	}
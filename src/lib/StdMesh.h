@@ -76,8 +76,14 @@ class StdMeshTrack
 public:
 	StdMeshTransformation GetTransformAt(float time, float length) const;
 
+	// Returns the keyframe at the given time, inserting it if there is none yet
+	StdMeshKeyFrame &AddFrame(float time);
+
 private:
-	std::map<float, StdMeshKeyFrame> Frames;
+	// Sorted by time. Times are stored separately so that looking up a
+	// position only touches one small contiguous array.
+	std::vector<float> Times;
+	std::vector<StdMeshKeyFrame> Frames;
 };
 
 // Animation, consists of one Track for each animated Bone
@@ -35,6 +35,7 @@ int pipe(int *phandles) { return _pipe(phandles, 10, O_BINARY); }
 #else
 
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
@@ -215,6 +216,34 @@ void ResetSocketError()
 
 #endif // HAVE_WINSOCK
 
+// send header and data with one call, so the data doesn't have to be copied behind the header
+// returns the number of bytes sent or SOCKET_ERROR
+static int SendGather(SOCKET sock, const void *pHdr, size_t iHdrSize, const void *pData, size_t iDataSize, const C4NetIO::addr_t *pAddr = nullptr)
+{
+#ifdef HAVE_WINSOCK
+	WSABUF Bufs[2];
+	Bufs[0].buf = const_cast<char *>(static_cast<const char *>(pHdr)); Bufs[0].len = iHdrSize;
+	Bufs[1].buf = const_cast<char *>(static_cast<const char *>(pData)); Bufs[1].len = iDataSize;
+	DWORD iBytesSent;
+	int iResult = pAddr ? WSASendTo(sock, Bufs, 2, &iBytesSent, 0, &*pAddr, pAddr->GetAddrLen(), nullptr, nullptr)
+	                    : WSASend(sock, Bufs, 2, &iBytesSent, 0, nullptr, nullptr);
+	return iResult == SOCKET_ERROR ? SOCKET_ERROR : int(iBytesSent);
+#else
+	iovec Bufs[2];
+	Bufs[0].iov_base = const_cast<void *>(pHdr); Bufs[0].iov_len = iHdrSize;
+	Bufs[1].iov_base = const_cast<void *>(pData); Bufs[1].iov_len = iDataSize;
+	msghdr Msg = {};
+	if (pAddr)
+	{
+		const sockaddr *pSockAddr = &*pAddr;
+		Msg.msg_name = const_cast<sockaddr *>(pSockAddr);
+		Msg.msg_namelen = pAddr->GetAddrLen();
+	}
+	Msg.msg_iov = Bufs; Msg.msg_iovlen = 2;
+	return ::sendmsg(sock, &Msg, 0);
+#endif
+}
+
 // *** C4NetIO::HostAddress
 void C4NetIO::HostAddress::Clear()
 {
@@ -1687,19 +1716,23 @@ void C4NetIOTCP::ClearConnectWaits() // (mt-safe)
 
 void C4NetIOTCP::PackPacket(const C4NetIOPacket &rPacket, StdBuf &rOutBuf)
 {
-	// packet data
-	uint8_t cFirstByte = 0xff;
-	uint32_t iSize = rPacket.getSize();
-	uint32_t iOASize = sizeof(cFirstByte) + sizeof(iSize) + iSize;
-
-	// enlarge buffer
-	int iPos = rOutBuf.getSize();
-	rOutBuf.Grow(iOASize);
+	// header
+	uint8_t Hdr[MaxPacketHeaderSize];
+	size_t iHdrSize = C4NetIOTCP::GetPacketHeader(rPacket, Hdr);
 
 	// write packet at end of outgoing buffer
-	*getMBufPtr<uint8_t>(rOutBuf, iPos) = cFirstByte; iPos += sizeof(uint8_t);
-	*getMBufPtr<uint32_t>(rOutBuf, iPos) = iSize; iPos += sizeof(uint32_t);
-	rOutBuf.Write(rPacket, iPos);
+	rOutBuf.Append(Hdr, iHdrSize);
+	rOutBuf.Append(rPacket);
+}
+
+size_t C4NetIOTCP::GetPacketHeader(const C4NetIOPacket &rPacket, uint8_t *pHdr)
+{
+	// first byte (0xff), then packet size
+	uint8_t cFirstByte = 0xff;
+	uint32_t iSize = rPacket.getSize();
+	memcpy(pHdr, &cFirstByte, sizeof(cFirstByte));
+	memcpy(pHdr + sizeof(cFirstByte), &iSize, sizeof(iSize));
+	return sizeof(cFirstByte) + sizeof(iSize);
 }
 
 size_t C4NetIOTCP::UnpackPacket(const StdBuf &IBuf, const C4NetIO::addr_t &addr)
@@ -1756,6 +1789,12 @@ bool C4NetIOTCP::Peer::Send(const C4NetIOPacket &rPacket) // (mt-safe)
 	if (!OBuf.isNull()) Send();
 	bool fSend = OBuf.isNull();
 
+	// nothing pending: send directly from the packet buffer, if the packet format allows it
+	uint8_t Hdr[MaxPacketHeaderSize];
+	size_t iHdrSize = fSend ? pParent->GetPacketHeader(rPacket, Hdr) : 0;
+	if (iHdrSize)
+		return SendDirect(Hdr, iHdrSize, rPacket);
+
 	// pack packet
 	pParent->PackPacket(rPacket, OBuf);
 
@@ -1763,6 +1802,44 @@ bool C4NetIOTCP::Peer::Send(const C4NetIOPacket &rPacket) // (mt-safe)
 	return fSend ? Send() : true;
 }
 
+bool C4NetIOTCP::Peer::SendDirect(const uint8_t *pHdr, size_t iHdrSize, const C4NetIOPacket &rPacket) // (mt-safe)
+{
+	CStdLock OLock(&OCSec);
+	assert(OBuf.isNull());
+
+	// send as much as possible
+	int iBytesSent;
+	if ((iBytesSent = SendGather(sock, pHdr, iHdrSize, rPacket.getData(), rPacket.getSize())) == SOCKET_ERROR)
+		if (!HaveWouldBlockError())
+		{
+			pParent->SetError("send failed", true);
+			return false;
+		}
+	size_t iSent = iBytesSent == SOCKET_ERROR ? 0 : iBytesSent;
+
+	// increase output rate
+	if (iSent) iORate += iSent + iTCPHeaderSize;
+
+	// everything sent?
+	if (iSent == iHdrSize + rPacket.getSize()) return true;
+
+	// buffer the rest
+	if (iSent < iHdrSize)
+	{
+		OBuf.Append(pHdr + iSent, iHdrSize - iSent);
+		OBuf.Append(rPacket);
+	}
+	else
+		OBuf.Append(rPacket.getPtr(iSent - iHdrSize), rPacket.getSize() - (iSent - iHdrSize));
+#ifndef STDSCHEDULER_USE_EVENTS
+	// Unblock parent so the FD-list can be refreshed
+	pParent->UnBlock();
+#endif
+
+	// ok
+	return true;
+}
+
 bool C4NetIOTCP::Peer::Send() // (mt-safe)
 {
 	CStdLock OLock(&OCSec);
@@ -2197,6 +2274,23 @@ bool C4NetIOSimpleUDP::Send(const C4NetIOPacket &rPacket)
 	return true;
 }
 
+bool C4NetIOSimpleUDP::SendGather(const addr_t &addr, const void *pHdr, size_t iHdrSize, const void *pData, size_t iDataSize)
+{
+	if (!fInit) { SetError("not yet initialized"); return false; }
+
+	// send it
+	if (::SendGather(sock, pHdr, iHdrSize, pData, iDataSize, &addr) != int(iHdrSize + iDataSize) &&
+	    !HaveWouldBlockError())
+	{
+		SetError("socket sendmsg failed", true);
+		return false;
+	}
+
+	// ok
+	ResetError();
+	return true;
+}
+
 bool C4NetIOSimpleUDP::Broadcast(const C4NetIOPacket &rPacket)
 {
 	// just set broadcast address and send
@@ -2953,21 +3047,32 @@ C4NetIOPacket C4NetIOUDP::Packet::GetFragment(nr_t iFNr, bool fBroadcastFlag) co
 {
 	assert(iFNr < FragmentCnt());
 	// create buffer
-	uint16_t iFragmentSize = FragmentSize(iFNr);
-	StdBuf Packet; Packet.New(sizeof(DataPacketHdr) + iFragmentSize);
+	StdBuf FragmentData = GetFragmentData(iFNr);
+	StdBuf Packet; Packet.New(sizeof(DataPacketHdr) + FragmentData.getSize());
 	// set up header
-	DataPacketHdr *pnHdr = getMBufPtr<DataPacketHdr>(Packet);
-	pnHdr->StatusByte = IPID_Data | (fBroadcastFlag ? 0x80 : 0x00);
-	pnHdr->Nr = iNr + iFNr;
-	pnHdr->FNr = iNr;
-	pnHdr->Size = Data.getSize();
+	GetFragmentHdr(iFNr, fBroadcastFlag, *getMBufPtr<DataPacketHdr>(Packet));
 	// copy data
-	Packet.Write(Data.getPart(iFNr * MaxDataSize, iFragmentSize),
-	             sizeof(DataPacketHdr));
+	Packet.Write(FragmentData, sizeof(DataPacketHdr));
 	// return
 	return C4NetIOPacket(Packet, Data.getAddr());
 }
 
+void C4NetIOUDP::Packet::GetFragmentHdr(nr_t iFNr, bool fBroadcastFlag, DataPacketHdr &rHdr) const
+{
+	assert(iFNr < FragmentCnt());
+	rHdr.StatusByte = IPID_Data | (fBroadcastFlag ? 0x80 : 0x00);
+	rHdr.Nr = iNr + iFNr;
+	rHdr.FNr = iNr;
+	rHdr.Size = Data.getSize();
+}
+
+StdBuf C4NetIOUDP::Packet::GetFragmentData(nr_t iFNr) const
+{
+	assert(iFNr < FragmentCnt());
+	// reference into the packet data, no copy
+	return Data.getPart(iFNr * MaxDataSize, FragmentSize(iFNr));
+}
+
 bool C4NetIOUDP::Packet::Complete() const
 {
 	if (Empty()) return false;
@@ -3531,14 +3636,22 @@ bool C4NetIOUDP::Peer::SendDirect(const Packet &rPacket, unsigned int iNr)
 {
 	// send one fragment only?
 	if (iNr + 1)
-		return SendDirect(rPacket.GetFragment(iNr - rPacket.GetNr()));
+		return SendFragment(rPacket, iNr - rPacket.GetNr());
 	// otherwise: send all fragments
 	bool fSuccess = true;
 	for (unsigned int i = 0; i < rPacket.FragmentCnt(); i++)
-		fSuccess &= SendDirect(rPacket.GetFragment(i));
+		fSuccess &= SendFragment(rPacket, i);
 	return fSuccess;
 }
 
+bool C4NetIOUDP::Peer::SendFragment(const Packet &rPacket, Packet::nr_t iFNr) // (mt-safe)
+{
+	// count outgoing
+	{ CStdLock StatLock(&StatCSec); iORate += sizeof(DataPacketHdr) + rPacket.GetFragmentData(iFNr).getSize() + iUDPHeaderSize; }
+	// forward call
+	return pParent->SendFragment(rPacket, iFNr, false, addr.AsIPv6());
+}
+
 bool C4NetIOUDP::Peer::SendDirect(C4NetIOPacket &&rPacket) // (mt-safe)
 {
 	// insert correct addr
@@ -3661,14 +3774,36 @@ bool C4NetIOUDP::BroadcastDirect(const Packet &rPacket, unsigned int iNr) // (mt
 {
 	// only one fragment?
 	if (iNr + 1)
-		return SendDirect(rPacket.GetFragment(iNr - rPacket.GetNr(), true));
+		return SendFragment(rPacket, iNr - rPacket.GetNr(), true, C4NetIOSimpleUDP::getMCAddr());
 	// send all fragments
 	bool fSuccess = true;
 	for (unsigned int iFrgm = 0; iFrgm < rPacket.FragmentCnt(); iFrgm++)
-		fSuccess &= SendDirect(rPacket.GetFragment(iFrgm, true));
+		fSuccess &= SendFragment(rPacket, iFrgm, true, C4NetIOSimpleUDP::getMCAddr());
 	return fSuccess;
 }
 
+bool C4NetIOUDP::SendFragment(const Packet &rPacket, Packet::nr_t iFNr, bool fBroadcast, const addr_t &addr) // (mt-safe)
+{
+#if defined(C4NETIO_DEBUG) || defined(C4NETIO_SIMULATE_PACKETLOSS)
+	// assemble the fragment, so it can be logged or dropped
+	C4NetIOPacket Fragment = rPacket.GetFragment(iFNr, fBroadcast);
+	if (!fBroadcast) Fragment.SetAddr(addr);
+	return SendDirect(std::move(Fragment));
+#else
+	DataPacketHdr Hdr;
+	rPacket.GetFragmentHdr(iFNr, fBroadcast, Hdr);
+	StdBuf FragmentData = rPacket.GetFragmentData(iFNr);
+	// statistics
+	if (fBroadcast)
+	{
+		CStdLock StatLock(&StatCSec);
+		iBroadcastRate += sizeof(Hdr) + FragmentData.getSize() + iUDPHeaderSize;
+	}
+	// send header and data without assembling them
+	return C4NetIOSimpleUDP::SendGather(addr, &Hdr, sizeof(Hdr), FragmentData.getData(), FragmentData.getSize());
+#endif
+}
+
 bool C4NetIOUDP::SendDirect(C4NetIOPacket &&rPacket) // (mt-safe)
 {
 	addr_t toaddr = rPacket.getAddr();
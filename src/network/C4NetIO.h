@@ -389,6 +389,11 @@ protected:
 	// Append packet data to output buffer
 	virtual void PackPacket(const C4NetIOPacket &rPacket, StdBuf &rOutBuf);
 
+	// Write the header that PackPacket puts in front of the unchanged packet data and return its size.
+	// Packets are then sent straight from their buffer. Return 0 if PackPacket has to be used.
+	static const size_t MaxPacketHeaderSize = 16;
+	virtual size_t GetPacketHeader(const C4NetIOPacket &rPacket, uint8_t *pHdr);
+
 	// Extract a packet from the start of the input buffer (if possible) and call OnPacket.
 	// Should return the numer of bytes used.
 	virtual size_t UnpackPacket(const StdBuf &rInBuf, const C4NetIO::addr_t &Addr);
@@ -432,6 +437,8 @@ protected:
 		bool Send(const C4NetIOPacket &rPacket);
 		// send as much data of the interal outgoing buffer as possible
 		bool Send();
+		// send a packet without going through the outgoing buffer (must be empty)
+		bool SendDirect(const uint8_t *pHdr, size_t iHdrSize, const C4NetIOPacket &rPacket);
 		// request buffer space for new input. Must call OnRecv or NoRecv afterwards!
 		void *GetRecvBuf(int iSize);
 		// called after the buffer returned by GetRecvBuf has been filled with fresh data
@@ -571,6 +578,9 @@ protected:
 	// multicast address
 	const addr_t &getMCAddr() const { return MCAddr; }
 
+	// send header and data as one packet without assembling them in a buffer
+	bool SendGather(const addr_t &addr, const void *pHdr, size_t iHdrSize, const void *pData, size_t iDataSize);
+
 	// (try to) control loopback
 	bool SetMCLoopback(int fLoopback);
 	bool getMCLoopback() const { return fMCLoopback; }
@@ -694,6 +704,8 @@ protected:
 		// fragmention
 		nr_t                 FragmentCnt() const;
 		C4NetIOPacket        GetFragment(nr_t iFNr, bool fBroadcastFlag = false) const;
+		void                 GetFragmentHdr(nr_t iFNr, bool fBroadcastFlag, DataPacketHdr &rHdr) const;
+		StdBuf               GetFragmentData(nr_t iFNr) const;
 		bool                 Complete() const;
 		bool                 FragmentPresent(nr_t iFNr) const;
 		bool                 AddFragment(const C4NetIOPacket &Packet, const C4NetIO::addr_t &addr);
@@ -849,6 +861,7 @@ protected:
 		// sending
 		bool SendDirect(const Packet &rPacket, unsigned int iNr = ~0);
 		bool SendDirect(C4NetIOPacket &&rPacket);
+		bool SendFragment(const Packet &rPacket, Packet::nr_t iFNr);
 
 		// events
 		void OnConn();
@@ -906,6 +919,7 @@ protected:
 
 	// sending
 	bool BroadcastDirect(const Packet &rPacket, unsigned int iNr = ~0u); // (mt-safe)
+	bool SendFragment(const Packet &rPacket, Packet::nr_t iFNr, bool fBroadcast, const addr_t &addr); // (mt-safe)
 
 	// multicast related
 	bool DoLoopbackTest();
@@ -399,11 +399,14 @@ void C4Network2IO::EndBroadcast()
 bool C4Network2IO::Broadcast(const C4NetIOPacket &rPkt)
 {
 	bool fSuccess = true;
+	// compress once for all connections. If that didn't help, the connections don't try again.
+	C4NetIOPacket Compressed;
+	const C4NetIOPacket &rSendPkt = CompressPacket(rPkt, Compressed) ? Compressed : rPkt;
 	// There is no broadcasting atm, emulate it
 	CStdLock ConnListLock(&ConnListCSec);
 	for (C4Network2IOConnection *pConn = pConnList; pConn; pConn = pConn->pNext)
 		if (pConn->isOpen() && pConn->isBroadcastTarget())
-			fSuccess &= pConn->Send(rPkt);
+			fSuccess &= pConn->Send(rSendPkt, false);
 	if(!fSuccess)
 		Log("Network: Warning! Broadcast failed.");
 	return fSuccess;
@@ -808,6 +811,50 @@ bool C4Network2IO::IsReferenceNeeded()
 	return !!pRefServer;
 }
 
+bool C4Network2IO::CompressPacket(const C4NetIOPacket &rPkt, C4NetIOPacket &rCompressed) // by both
+{
+	// worth it? Resource data is compressed already, packets before PID_PacketLogStart are needed to connect.
+	if (!Config.Network.PacketCompression || rPkt.getSize() < C4NetCompressMinSize)
+		return false;
+	if (rPkt.getStatus() < PID_PacketLogStart || rPkt.getStatus() == PID_Compressed || rPkt.getStatus() == PID_NetResData)
+		return false;
+	// status, original status, original size, deflated data
+	const size_t iHdrSize = 2 + sizeof(uint32_t);
+	uint32_t iSize = rPkt.getPSize();
+	uLongf iDataSize = compressBound(iSize);
+	StdBuf Buf; Buf.New(iHdrSize + iDataSize);
+	*getMBufPtr<uint8_t>(Buf, 0) = PID_Compressed;
+	*getMBufPtr<uint8_t>(Buf, 1) = rPkt.getStatus();
+	Buf.Write(&iSize, sizeof(iSize), 2);
+	if (compress(getMBufPtr<Bytef>(Buf, iHdrSize), &iDataSize, reinterpret_cast<const Bytef *>(rPkt.getPData()), iSize) != Z_OK)
+		return false;
+	// didn't help?
+	if (iHdrSize + iDataSize >= rPkt.getSize())
+		return false;
+	Buf.SetSize(iHdrSize + iDataSize);
+	rCompressed.Take(std::move(Buf));
+	rCompressed.SetAddr(rPkt.getAddr());
+	return true;
+}
+
+bool C4Network2IO::UncompressPacket(const C4NetIOPacket &rPkt, C4NetIOPacket &rUncompressed) // by both
+{
+	const size_t iHdrSize = 2 + sizeof(uint32_t);
+	if (rPkt.getSize() < iHdrSize) return false;
+	uint32_t iSize;
+	memcpy(&iSize, rPkt.getPtr(2), sizeof(iSize));
+	// deflate can't compress better than about 1:1032, don't let bogus sizes allocate huge buffers
+	if (iSize / 2048 > rPkt.getSize()) return false;
+	StdBuf Buf; Buf.New(1 + iSize);
+	*getMBufPtr<uint8_t>(Buf, 0) = *getBufPtr<uint8_t>(rPkt, 1);
+	uLongf iDataSize = iSize;
+	if (uncompress(getMBufPtr<Bytef>(Buf, 1), &iDataSize, getBufPtr<Bytef>(rPkt, iHdrSize), rPkt.getSize() - iHdrSize) != Z_OK || iDataSize != iSize)
+		return false;
+	rUncompressed.Take(std::move(Buf));
+	rUncompressed.SetAddr(rPkt.getAddr());
+	return true;
+}
+
 bool C4Network2IO::doAutoAccept(const C4ClientCore &CCore, const C4Network2IOConnection &Conn)
 {
 	CStdLock AALock(&AutoAcceptCSec);
@@ -832,6 +879,22 @@ bool C4Network2IO::HandlePacket(const C4NetIOPacket &rPacket, C4Network2IOConnec
 {
 	// security: add connection reference
 	if (!pConn) return false;
+
+	// compressed? handle the original packet
+	if (rPacket.getStatus() == PID_Compressed)
+	{
+		C4NetIOPacket Uncompressed;
+		if (!UncompressPacket(rPacket, Uncompressed) || Uncompressed.getStatus() == PID_Compressed)
+		{
+			Application.InteractiveThread.ThreadLog("Network: error: Failed to uncompress packet");
+#ifndef _DEBUG
+			pConn->Close();
+#endif
+			return false;
+		}
+		return HandlePacket(Uncompressed, pConn, fThread);
+	}
+
 	pConn->AddRef();
 	
 	// accept only PID_Conn and PID_Ping on non-accepted connections
@@ -1465,8 +1528,12 @@ void C4Network2IOConnection::Close()
 	pNetClass->Close(PeerAddr);
 }
 
-bool C4Network2IOConnection::Send(const C4NetIOPacket &rPkt)
+bool C4Network2IOConnection::Send(const C4NetIOPacket &rPkt, bool fCompress)
 {
+	// compress (broadcasts are compressed before)
+	C4NetIOPacket Compressed;
+	if (fCompress && C4Network2IO::CompressPacket(rPkt, Compressed))
+		return Send(Compressed, false);
 	// some packets shouldn't go into the log
 	if (rPkt.getStatus() < PID_PacketLogStart)
 	{
@@ -37,6 +37,9 @@ const int C4NetTimer                = 500,  // ms
           C4NetAcceptTimeout        = 10,   // s
           C4NetPingTimeout          = 30000;// ms
 
+// smaller packets aren't worth compressing
+const size_t C4NetCompressMinSize   = 128;  // bytes
+
 // client count
 const int C4NetMaxClients = 256;
 
@@ -158,6 +161,10 @@ public:
 	void SetReference(class C4Network2Reference *pReference);
 	bool IsReferenceNeeded();
 
+	// compression (PID_Compressed)
+	static bool CompressPacket(const C4NetIOPacket &rPkt, C4NetIOPacket &rCompressed); // by both
+	static bool UncompressPacket(const C4NetIOPacket &rPkt, C4NetIOPacket &rUncompressed); // by both
+
 protected:
 	// *** callbacks
 	// C4NetIO-Callbacks
@@ -316,7 +323,7 @@ public:
 	// connection operations
 	bool Connect();
 	void Close();
-	bool Send(const C4NetIOPacket &rPkt);
+	bool Send(const C4NetIOPacket &rPkt, bool fCompress = true); // fCompress=false: packet was offered to CompressPacket already
 	void SetBroadcastTarget(bool fSet); // (only call after C4Network2IO::BeginBroadcast!)
 
 	// statistics
@@ -153,6 +153,7 @@ private:
 
 	// Overridden
 	void PackPacket(const C4NetIOPacket &rPacket, StdBuf &rOutBuf) override;
+	size_t GetPacketHeader(const C4NetIOPacket &rPacket, uint8_t *pHdr) override { return 0; }
 	size_t UnpackPacket(const StdBuf &rInBuf, const C4NetIO::addr_t &addr) override;
 
 	// Callbacks
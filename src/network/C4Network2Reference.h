@@ -112,6 +112,7 @@ public:
 protected:
 	// Overridden
 	void PackPacket(const C4NetIOPacket &rPacket, StdBuf &rOutBuf) override;
+	size_t GetPacketHeader(const C4NetIOPacket &rPacket, uint8_t *pHdr) override { return 0; }
 	size_t UnpackPacket(const StdBuf &rInBuf, const C4NetIO::addr_t &addr) override;
 
 private:
@@ -156,6 +157,7 @@ protected:
 
 	// Overridden
 	void PackPacket(const C4NetIOPacket &rPacket, StdBuf &rOutBuf) override;
+	size_t GetPacketHeader(const C4NetIOPacket &rPacket, uint8_t *pHdr) override { return 0; }
 	size_t UnpackPacket(const StdBuf &rInBuf, const C4NetIO::addr_t &addr) override;
 
 	// Callbacks
@@ -235,7 +235,7 @@ void C4Network2ResChunkData::Clear()
 	}
 }
 
-int32_t C4Network2ResChunkData::GetChunkToRetrieve(const C4Network2ResChunkData &Available, int32_t iLoadingCnt, int32_t *pLoading) const
+int32_t C4Network2ResChunkData::GetChunkToRetrieve(const C4Network2ResChunkData &Available, int32_t iLoadingCnt, int32_t *pLoading, const std::vector<const C4Network2ResChunkData *> &OtherSources) const
 {
 	// (this version is highly calculation-intensitive, yet the most satisfactory
 	//  solution I could find)
@@ -247,6 +247,14 @@ int32_t C4Network2ResChunkData::GetChunkToRetrieve(const C4Network2ResChunkData
 		ChData.AddChunk(pLoading[i]);
 	// nothing to retrieve?
 	if (ChData.isComplete()) return -1;
+	// prefer rare chunks: leave out what other sources have as well, as long as something remains
+	for (const C4Network2ResChunkData *pOther : OtherSources)
+	{
+		C4Network2ResChunkData ChData2(ChData);
+		ChData2.Merge(*pOther);
+		if (!ChData2.isComplete())
+			ChData.Merge(*pOther);
+	}
 	// invert to get everything that should be retrieved
 	C4Network2ResChunkData ChData2; ChData.GetNegative(ChData2);
 	// select chunk (random)
@@ -872,8 +880,8 @@ void C4Network2Res::OnStatus(const C4Network2ResChunkData &rChunkData, C4Network
 	pChunks->ClientID = pBy->getClientID();
 	pChunks->Chunks = rChunkData;
 	// check load
-	if (!StartLoad(pChunks->ClientID, pChunks->Chunks))
-		RemoveCChunks(pCChunks);
+	if (!StartLoad(pChunks))
+		RemoveCChunks(pChunks);
 }
 
 void C4Network2Res::OnChunk(const C4Network2ResChunk &rChunk)
@@ -897,7 +905,13 @@ void C4Network2Res::OnChunk(const C4Network2ResChunk &rChunk)
 		{
 			pNext = pLoad->Next();
 			if (static_cast<uint32_t>(pLoad->getChunk()) == rChunk.getChunkNr())
+			{
+				// the client keeps up: allow one more request
+				ClientChunks *pChunks = GetCChunks(pLoad->getByClient());
+				if (pChunks && pChunks->MaxLoad < C4NetResClientMaxLoad)
+					pChunks->MaxLoad++;
 				RemoveLoad(pLoad);
+			}
 		}
 	}
 	// complete?
@@ -921,6 +935,10 @@ bool C4Network2Res::DoLoad()
 			pNext = pLoad->Next();
 			if (pLoad->CheckTimeout())
 			{
+				// back off
+				ClientChunks *pChunks = GetCChunks(pLoad->getByClient());
+				if (pChunks)
+					pChunks->MaxLoad = std::max<int32_t>(1, pChunks->MaxLoad / 2);
 				RemoveLoad(pLoad);
 				iLoadsRemoved++;
 			}
@@ -1031,7 +1049,7 @@ void C4Network2Res::StartNewLoads()
 			if (pC[i])
 			{
 				// try to start load
-				if (!StartLoad(pC[i]->ClientID, pC[i]->Chunks))
+				if (!StartLoad(pC[i]))
 					{ RemoveCChunks(pC[i]); pC[i] = nullptr; continue; }
 				// success?
 				if (iLoadCnt > ioLoadCnt) break;
@@ -1044,20 +1062,28 @@ void C4Network2Res::StartNewLoads()
 	delete [] pC;
 }
 
-bool C4Network2Res::StartLoad(int32_t iFromClient, const C4Network2ResChunkData &Available)
+bool C4Network2Res::StartLoad(const ClientChunks *pFrom)
 {
 	assert(pParent && pParent->getIOClass());
+	int32_t iFromClient = pFrom->ClientID;
 	// all slots used? ignore
 	if (iLoadCnt + 1 >= C4NetResMaxLoad) return true;
-	// is there already a load by this client? ignore
+	// as many loads by this client as it can handle? ignore
+	int32_t iClientLoadCnt = 0;
 	for (C4Network2ResLoad *pPos = pLoads; pPos; pPos = pPos->Next())
 		if (pPos->getByClient() == iFromClient)
-			return true;
+			iClientLoadCnt++;
+	if (iClientLoadCnt >= pFrom->MaxLoad)
+		return true;
 	// find chunk to retrieve
 	int32_t iLoads[C4NetResMaxLoad]; int32_t i = 0;
 	for (C4Network2ResLoad *pLoad = pLoads; pLoad; pLoad = pLoad->Next())
 		iLoads[i++] = pLoad->getChunk();
-	int32_t iRetrieveChunk = Chunks.GetChunkToRetrieve(Available, i, iLoads);
+	std::vector<const C4Network2ResChunkData *> OtherSources;
+	for (ClientChunks *pChunks = pCChunks; pChunks; pChunks = pChunks->Next)
+		if (pChunks != pFrom)
+			OtherSources.push_back(&pChunks->Chunks);
+	int32_t iRetrieveChunk = Chunks.GetChunkToRetrieve(pFrom->Chunks, i, iLoads, OtherSources);
 	// nothing? ignore
 	if (iRetrieveChunk < 0 || (uint32_t)iRetrieveChunk >= Core.getChunkCnt())
 		return true;
@@ -1121,6 +1147,14 @@ void C4Network2Res::RemoveLoad(C4Network2ResLoad *pLoad)
 	iLoadCnt--;
 }
 
+C4Network2Res::ClientChunks *C4Network2Res::GetCChunks(int32_t iClientID)
+{
+	for (ClientChunks *pChunks = pCChunks; pChunks; pChunks = pChunks->Next)
+		if (pChunks->ClientID == iClientID)
+			return pChunks;
+	return nullptr;
+}
+
 void C4Network2Res::RemoveCChunks(ClientChunks *pChunks)
 {
 	if (pChunks == pCChunks)
@@ -30,7 +30,9 @@ const uint32_t C4NetResChunkSize = 10U * 1024U;
 const int32_t C4NetResDiscoverTimeout = 10, // (s)
               C4NetResDiscoverInterval = 1, // (s)
               C4NetResStatusInterval = 1, // (s)
-              C4NetResMaxLoad = 5,
+              C4NetResMaxLoad = 33,
+              C4NetResClientStartLoad = 2, // concurrent chunk requests per client at start,
+              C4NetResClientMaxLoad = 16,  // raised by one for every chunk received and halved on timeout
               C4NetResLoadTimeout = 60, // (s)
               C4NetResDeleteTime = 60, // (s)
               C4NetResMaxBigicon = 20; // maximum size, in KB, of bigicon
@@ -163,7 +165,7 @@ public:
 
 	void Clear();
 
-	int32_t GetChunkToRetrieve(const C4Network2ResChunkData &Available, int32_t iLoadingCnt, int32_t *pLoading) const;
+	int32_t GetChunkToRetrieve(const C4Network2ResChunkData &Available, int32_t iLoadingCnt, int32_t *pLoading, const std::vector<const C4Network2ResChunkData *> &OtherSources = {}) const;
 
 protected:
 	// helpers
@@ -224,7 +226,7 @@ protected:
 
 	// loading
 	bool fLoading;
-	struct ClientChunks { C4Network2ResChunkData Chunks; int32_t ClientID; ClientChunks *Next; }
+	struct ClientChunks { C4Network2ResChunkData Chunks; int32_t ClientID; int32_t MaxLoad{C4NetResClientStartLoad}; ClientChunks *Next; }
 	*pCChunks;
 	time_t iDiscoverStartTime;
 	C4Network2ResLoad *pLoads;
@@ -291,12 +293,13 @@ protected:
 	int32_t OpenFileRead(); int32_t OpenFileWrite();
 
 	void StartNewLoads();
-	bool StartLoad(int32_t iFromClient, const C4Network2ResChunkData &Chunks);
+	bool StartLoad(const ClientChunks *pFrom);
 	void EndLoad();
 	void ClearLoad();
 
 	void RemoveLoad(C4Network2ResLoad *pLoad);
 	void RemoveCChunks(ClientChunks *pChunks);
+	ClientChunks *GetCChunks(int32_t iClientID);
 
 	bool OptimizeStandalone(bool fSilent);
 
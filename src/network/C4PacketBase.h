@@ -95,6 +95,9 @@ enum C4PacketType
 	// post mortem
 	PID_PostMortem    = 0x06,
 
+	// deflated packet (original status, size and data)
+	PID_Compressed    = 0x07,
+
 	// (packets before this ID won't be recovered post-mortem)
 	PID_PacketLogStart = 0x04,
 
@@ -0,0 +1,78 @@
+/*
+ * OpenClonk, http://www.openclonk.org
+ *
+ * Copyright (c) 2016, The OpenClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+// broadphase of C4GameObjects::CrossCheck
+
+#ifndef INC_C4CrossCheckTargets
+#define INC_C4CrossCheckTargets
+
+// All possible hit and collection targets, sorted by x position. Used to skip
+// objects that have no target inside their shape before walking their sectors.
+// T needs GetX(), GetY(), Shape and Layer like C4Object.
+template<class T> class C4CrossCheckTargets
+{
+public:
+	// Script callbacks may move or change any object, so the targets are collected
+	// again after a callback. Each collection sorts all targets, which costs less than
+	// the sector walk of a single collecting object in a crowd. But in a fight with
+	// hits every tick, there could be one collection per collecting object. So after
+	// this many collections in one pass, no more objects are skipped.
+	static const int32_t MaxCollections = 8;
+
+private:
+	std::vector<T *> Targets;
+	int32_t Collections = 0;
+	bool Valid = false;
+
+public:
+	void Reset() { Collections = 0; Valid = false; } // at the start of a pass
+	void Invalidate() { Valid = false; } // after any callback
+
+	// Whether obj1 has no target in its shape. The test is the same as in the sector walk
+	// but without the sector restriction, so it never skips an object that the walk would
+	// find a target for. Targets are taken from all objects for which IsTarget is true.
+	template<class List, class IsTarget> bool CanSkip(const T *obj1, List &objects, IsTarget is_target)
+	{
+		if (!Valid)
+		{
+			if (Collections >= MaxCollections) return false;
+			Collect(objects, is_target);
+		}
+		int32_t x0 = obj1->GetX() + obj1->Shape.x, y0 = obj1->GetY() + obj1->Shape.y;
+		auto it = std::lower_bound(Targets.begin(), Targets.end(), x0,
+		                           [](const T *obj, int32_t x) { return obj->GetX() < x; });
+		for (; it != Targets.end() && (*it)->GetX() < x0 + obj1->Shape.Wdt; ++it)
+			if (*it != obj1 &&
+			    Inside<int32_t>((*it)->GetY() - y0, 0, obj1->Shape.Hgt - 1) &&
+			    obj1->Layer == (*it)->Layer)
+				return false;
+		return true;
+	}
+
+private:
+	template<class List, class IsTarget> void Collect(List &objects, IsTarget is_target)
+	{
+		Targets.clear();
+		for (T *obj : objects)
+			if (is_target(obj))
+				Targets.push_back(obj);
+		std::sort(Targets.begin(), Targets.end(),
+		          [](const T *a, const T *b) { return a->GetX() < b->GetX(); });
+		Valid = true;
+		++Collections;
+	}
+};
+
+#endif
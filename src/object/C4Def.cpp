@@ -30,9 +30,11 @@
 #include "landscape/C4SolidMask.h"
 #include "lib/StdColors.h"
 #include "lib/StdMeshLoader.h"
+#include "object/C4DefList.h"
 #include "object/C4Object.h"
 #include "platform/C4FileMonitor.h"
 #include "platform/C4SoundSystem.h"
+#include "platform/C4TimeMilliseconds.h"
 #include "player/C4RankSystem.h"
 
 // Helper class to load additional resources required for meshes from
@@ -48,7 +50,7 @@ public:
 		C4Surface* surface = new C4Surface;
 		// Suppress error message here, StdMeshMaterial loader
 		// will show one.
-		if (!surface->Read(Group, GetExtension(filename), C4SF_MipMap))
+		if (!surface->ReadEntry(Group, filename, C4SF_MipMap))
 			{ delete surface; surface = nullptr; }
 		return surface;
 	}
@@ -143,9 +145,28 @@ bool C4Def::LoadDefCore(C4Group &hGroup)
 	StdStrBuf Source;
 	if (hGroup.LoadEntryString(C4CFN_DefCore,&Source))
 	{
-		StdStrBuf Name = hGroup.GetFullName() + (const StdStrBuf &)FormatString("%cDefCore.txt", DirectorySeparator);
-		if (!Compile(Source.getData(), Name.getData()))
-			return false;
+		// Unchanged DefCores are read from the binary cache
+		StdCopyBuf &Cached = ::Definitions.GetCachedDefCore(Source);
+		bool fCached = false;
+		if (Cached.getSize())
+		{
+			try
+			{
+				CompileFromBuf<StdCompilerBinRead>(mkNamingAdapt(*this, "DefCore"), Cached);
+				fCached = true;
+			}
+			catch (StdCompiler::Exception *pExc)
+			{
+				delete pExc;
+			}
+		}
+		if (!fCached)
+		{
+			StdStrBuf Name = hGroup.GetFullName() + (const StdStrBuf &)FormatString("%cDefCore.txt", DirectorySeparator);
+			if (!Compile(Source.getData(), Name.getData()))
+				return false;
+			Cached = DecompileToBuf<StdCompilerBinWrite>(mkNamingAdapt(*this, "DefCore"));
+		}
 		Source.Clear();
 
 		// Check mass
@@ -366,10 +387,19 @@ bool C4Def::Load(C4Group &hGroup,
 	if (AddFileMonitoring) Game.pFileMonitor->AddDirectory(Filename);
 
 	// Pre-read all images and shader stuff because they ar eaccessed in unpredictable order during loading
+	C4TimeMilliseconds tPhase = C4TimeMilliseconds::Now();
 	hGroup.PreCacheEntries(C4CFN_ShaderFiles);
 	hGroup.PreCacheEntries(C4CFN_ImageFiles);
-
+	// Decode the images that LoadGraphics needs on worker threads while the rest of the definition is loaded.
+	// The caller discards unused images.
+	if (dwLoadWhat & C4D_Load_Bitmap)
+		for (const char *szWildcard : { C4CFN_DefGraphicsEx, C4CFN_ClrByOwnerEx, C4CFN_NormalMapEx })
+			C4Surface::ScheduleDecoding(hGroup, szWildcard);
+	::Definitions.LoadTimes.Files += C4TimeMilliseconds::Now() - tPhase;
+
+	tPhase = C4TimeMilliseconds::Now();
 	LoadMeshMaterials(hGroup, gfx_backup);
+	::Definitions.LoadTimes.Graphics += C4TimeMilliseconds::Now() - tPhase;
 	bool fSuccess = LoadParticleDef(hGroup);
 
 	// Read DefCore
@@ -379,18 +409,24 @@ bool C4Def::Load(C4Group &hGroup,
 	if (fSuccess && Game.C4S.Definitions.SkipDefs.GetIDCount(id, 1)) return false;
 
 	// Read sounds, even if not a valid def (for pure ocd sound folders)
+	tPhase = C4TimeMilliseconds::Now();
 	if (dwLoadWhat & C4D_Load_Sounds) LoadSounds(hGroup, pSoundSystem);
+	::Definitions.LoadTimes.Sounds += C4TimeMilliseconds::Now() - tPhase;
 
 	// cancel if not a valid definition
 	if (!fSuccess) return false;
 
 	// Read and parse SolidMask bitmap
-	if (!LoadSolidMask(hGroup)) return false;
+	tPhase = C4TimeMilliseconds::Now();
+	fSuccess = LoadSolidMask(hGroup);
 
 	// Read surface bitmap, meshes, skeletons
-	if ((dwLoadWhat & C4D_Load_Bitmap) && !LoadGraphics(hGroup, loader)) return false;
+	if (fSuccess && (dwLoadWhat & C4D_Load_Bitmap)) fSuccess = LoadGraphics(hGroup, loader);
+	::Definitions.LoadTimes.Graphics += C4TimeMilliseconds::Now() - tPhase;
+	if (!fSuccess) return false;
 
 	// Read string table
+	tPhase = C4TimeMilliseconds::Now();
 	C4Language::LoadComponentHost(&StringTable, hGroup, C4CFN_ScriptStringTbl, szLanguage);
 
 	// Register ID with script engine
@@ -399,6 +435,7 @@ bool C4Def::Load(C4Group &hGroup,
 
 	// Read script
 	if (dwLoadWhat & C4D_Load_Script) LoadScript(hGroup, szLanguage);
+	::Definitions.LoadTimes.Scripts += C4TimeMilliseconds::Now() - tPhase;
 
 	// Read clonknames
 	if (dwLoadWhat & C4D_Load_ClonkNames) LoadClonkNames(hGroup, pClonkNames, szLanguage);
@@ -20,13 +20,18 @@
 #include "C4Include.h"
 #include "object/C4DefList.h"
 
+#include "C4Version.h"
+
 #include "c4group/C4Components.h"
 #include "control/C4Record.h"
 #include "game/C4GameScript.h"
 #include "game/C4GameVersion.h"
+#include "graphics/C4Surface.h"
+#include "lib/SHA1.h"
 #include "lib/StdMeshLoader.h"
 #include "object/C4Def.h"
 #include "platform/C4FileMonitor.h"
+#include "platform/C4TimeMilliseconds.h"
 
 namespace
 {
@@ -58,6 +63,26 @@ namespace
 	};
 }
 
+namespace
+{
+	// On-disk format of the DefCore cache
+	struct C4DefCoreCacheFile
+	{
+		struct Entry
+		{
+			uint8_t Hash[SHA_DIGEST_LENGTH];
+			StdCopyBuf Data;
+			void CompileFunc(StdCompiler *pComp) { pComp->Value(toC4CArrU(Hash)); pComp->Value(Data); }
+		};
+		StdCopyStrBuf Stamp;
+		std::vector<Entry> Entries;
+		void CompileFunc(StdCompiler *pComp) { pComp->Value(Stamp); pComp->Value(mkSTLContainerAdapt(Entries)); }
+	};
+
+	// Caches of other engine builds may have been compiled differently
+	const char *DefCoreCacheStamp = C4VERSION " " C4REVISION " " C4REVISION_TS;
+}
+
 C4DefList::C4DefList() : SkeletonLoader(new C4SkeletonManager)
 {
 	Default();
@@ -99,7 +124,10 @@ int32_t C4DefList::Load(C4Group &hGroup, DWORD dwLoadWhat,
 	{
 		if ((nDef = new C4Def))
 		{
-			if (nDef->Load(hGroup, *SkeletonLoader, dwLoadWhat, szLanguage, pSoundSystem) && Add(nDef, fOverload))
+			bool fLoaded = nDef->Load(hGroup, *SkeletonLoader, dwLoadWhat, szLanguage, pSoundSystem);
+			// Images that were decoded ahead but not used point into the group
+			C4Surface::DiscardDecoding();
+			if (fLoaded && Add(nDef, fOverload))
 			{
 				iResult++; fPrimaryDef = true;
 			}
@@ -155,6 +183,8 @@ int32_t C4DefList::Load(const char *szFilename,
                         C4SoundSystem *pSoundSystem,
                         bool fOverload, int32_t iMinProgress, int32_t iMaxProgress)
 {
+	C4TimeMilliseconds tStart = C4TimeMilliseconds::Now();
+	LoadTimes = {};
 	// Load from specified file
 	C4Group hGroup;
 	if (!Reloc.Open(hGroup, szFilename))
@@ -167,6 +197,9 @@ int32_t C4DefList::Load(const char *szFilename,
 	int32_t nDefs = Load(hGroup,dwLoadWhat,szLanguage,pSoundSystem,fOverload,true,iMinProgress,iMaxProgress);
 	hGroup.Close();
 
+	LogSilentF("%s: %d definitions in %d ms (files %u ms, graphics %u ms, sounds %u ms, scripts %u ms)", GetFilename(szFilename), (int) nDefs,
+	           (int) (C4TimeMilliseconds::Now() - tStart), LoadTimes.Files, LoadTimes.Graphics, LoadTimes.Sounds, LoadTimes.Scripts);
+
 	// progress (could go down one level of recursion...)
 	if (iMinProgress != iMaxProgress) Game.SetInitProgress(float(iMaxProgress));
 
@@ -414,6 +447,7 @@ void C4DefList::Default()
 {
 	FirstDef=nullptr;
 	LoadFailure=false;
+	LoadTimes = {};
 	table.clear();
 }
 
@@ -433,7 +467,9 @@ bool C4DefList::Reload(C4Def *pDef, DWORD dwLoadWhat, const char *szLanguage, C4
 	// clear all skeletons in that group, so that deleted skeletons are also deleted in the engine
 	SkeletonLoader->RemoveSkeletonsInGroup(hGroup.GetName());
 	// load the definition
-	if (!pDef->Load(hGroup, *SkeletonLoader, dwLoadWhat, szLanguage, pSoundSystem, &GfxBackup)) return false;
+	bool fLoaded = pDef->Load(hGroup, *SkeletonLoader, dwLoadWhat, szLanguage, pSoundSystem, &GfxBackup);
+	C4Surface::DiscardDecoding();
+	if (!fLoaded) return false;
 	hGroup.Close();
 	// rebuild quick access table
 	BuildTable();
@@ -535,3 +571,54 @@ const char *C4DefList::GetLocalizedGroupFolderName(const char *folder_path) cons
 	if (iter == localized_group_folder_names.end()) return nullptr;
 	return iter->second.getData();
 }
+
+StdCopyBuf &C4DefList::GetCachedDefCore(const StdStrBuf &Source)
+{
+	sha1 ctx;
+	ctx.process_bytes(Source.getData(), Source.getLength());
+	BYTE hash[SHA_DIGEST_LENGTH];
+	ctx.get_digest((sha1::digest_type) *hash);
+	DefCoreCacheEntry &entry = DefCoreCache[std::string(reinterpret_cast<char *>(hash), SHA_DIGEST_LENGTH)];
+	entry.Used = true;
+	if (!entry.Data.getSize()) DefCoreCacheModified = true;
+	return entry.Data;
+}
+
+void C4DefList::LoadDefCoreCache()
+{
+	// Only read once, the cache stays valid between rounds
+	if (DefCoreCacheLoaded) return;
+	DefCoreCacheLoaded = true;
+	StdBuf Buf;
+	if (!Buf.LoadFromFile(Config.AtUserDataPath(C4CFN_DefCoreCache))) return;
+	C4DefCoreCacheFile File;
+	try
+	{
+		CompileFromBuf<StdCompilerBinRead>(File, Buf);
+	}
+	catch (StdCompiler::Exception *pExc)
+	{
+		delete pExc;
+		return;
+	}
+	if (File.Stamp != DefCoreCacheStamp) return;
+	for (auto &Entry : File.Entries)
+		DefCoreCache[std::string(reinterpret_cast<char *>(Entry.Hash), SHA_DIGEST_LENGTH)].Data = std::move(Entry.Data);
+}
+
+void C4DefList::SaveDefCoreCache()
+{
+	if (!DefCoreCacheModified) return;
+	DefCoreCacheModified = false;
+	// Only store what has been used, so DefCores of old definition versions do not accumulate
+	C4DefCoreCacheFile File;
+	File.Stamp.Copy(DefCoreCacheStamp);
+	for (auto &Entry : DefCoreCache)
+		if (Entry.second.Used && Entry.second.Data.getSize())
+		{
+			File.Entries.emplace_back();
+			memcpy(File.Entries.back().Hash, Entry.first.data(), SHA_DIGEST_LENGTH);
+			File.Entries.back().Data.Copy(Entry.second.Data);
+		}
+	DecompileToBuf<StdCompilerBinWrite>(File).SaveToFile(Config.AtUserDataPath(C4CFN_DefCoreCache));
+}
@@ -29,6 +29,11 @@ public:
 	~C4DefList() override;
 public:
 	bool LoadFailure;
+	// Milliseconds spent in the phases of definition loading, logged after each definition file
+	struct LoadTimes
+	{
+		uint32_t Files, Graphics, Sounds, Scripts;
+	} LoadTimes;
 	typedef std::map<C4ID, C4Def*> Table;
 	Table table;
 protected:
@@ -36,6 +41,14 @@ protected:
 	// Localized names of definition parent groups that do not contain a definition themselves
 	// Loaded for editor definition list
 	std::map<StdCopyStrBuf, StdCopyStrBuf> localized_group_folder_names;
+	// Binary DefCores by SHA1 of their DefCore.txt. Kept in the user path, so unchanged definitions skip text parsing on the next start.
+	struct DefCoreCacheEntry
+	{
+		StdCopyBuf Data;
+		bool Used = false;
+	};
+	std::map<std::string, DefCoreCacheEntry> DefCoreCache;
+	bool DefCoreCacheLoaded = false, DefCoreCacheModified = false;
 public:
 	void Default();
 	void Clear();
@@ -70,6 +83,9 @@ public:
 	void Synchronize();
 	void AppendAndIncludeSkeletons();
 	StdMeshSkeletonLoader& GetSkeletonLoader();
+	StdCopyBuf &GetCachedDefCore(const StdStrBuf &Source); // binary DefCore compiled from Source. If empty, it is to be filled by the caller.
+	void LoadDefCoreCache();
+	void SaveDefCoreCache();
 	const char *GetLocalizedGroupFolderName(const char *folder_path) const;
 
 	// callback from font renderer: get ID image
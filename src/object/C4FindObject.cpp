@@ -342,19 +342,20 @@ int32_t C4FindObject::Count(const C4ObjectList &Objs, const C4LSectors &Sct)
 		C4ObjectList *pLst = Area.FirstObjectShapes(&pSct);
 		// Check if a single-sector check is enough
 		if (!Area.Next(pSct))
-			return Count(pSct->ObjectShapes);
+			return IsImpossibleInSector(pSct) ? 0 : Count(pSct->ObjectShapes);
 		// Create marker, count over all areas
 		uint32_t iMarker = ::Objects.GetNextMarker();
 		int32_t iCount = 0;
 		for (; pLst; pLst=Area.NextObjectShapes(pLst, &pSct))
-			for (C4Object *obj : Objs)
-				if (obj->Status)
-					if (obj->Marker != iMarker)
-					{
-						obj->Marker = iMarker;
-						if (Check(obj))
-							iCount++;
-					}
+			if (!IsImpossibleInSector(pSct))
+				for (C4Object *obj : *pLst)
+					if (obj->Status)
+						if (obj->Marker != iMarker)
+						{
+							obj->Marker = iMarker;
+							if (Check(obj))
+								iCount++;
+						}
 		return iCount;
 	}
 	else
@@ -363,7 +364,8 @@ int32_t C4FindObject::Count(const C4ObjectList &Objs, const C4LSectors &Sct)
 		C4LArea Area(&::Objects.Sectors, *pBounds); C4LSector *pSct;
 		int32_t iCount = 0;
 		for (C4ObjectList *pLst=Area.FirstObjects(&pSct); pLst; pLst=Area.NextObjects(pLst, &pSct))
-			iCount += Count(*pLst);
+			if (!IsImpossibleInSector(pSct))
+				iCount += Count(*pLst);
 		return iCount;
 	}
 }
@@ -384,7 +386,7 @@ C4Object *C4FindObject::Find(const C4ObjectList &Objs, const C4LSectors &Sct)
 		C4LArea Area(&::Objects.Sectors, *pBounds); C4LSector *pSct;
 		C4Object *pObj;
 		for (C4ObjectList *pLst=Area.FirstObjectShapes(&pSct); pLst; pLst=Area.NextObjectShapes(pLst, &pSct))
-			if ((pObj = Find(*pLst)))
+			if (!IsImpossibleInSector(pSct) && (pObj = Find(*pLst)))
 			{
 				if (!pSort)
 					return pObj;
@@ -399,7 +401,7 @@ C4Object *C4FindObject::Find(const C4ObjectList &Objs, const C4LSectors &Sct)
 		C4Object *pObj;
 		for (C4ObjectList *pLst=Area.FirstObjects(&pSct); pLst; pLst=Area.NextObjects(pLst, &pSct))
 		{
-			if ((pObj = Find(*pLst)))
+			if (!IsImpossibleInSector(pSct) && (pObj = Find(*pLst)))
 			{
 				if (!pSort)
 					return pObj;
@@ -431,26 +433,27 @@ C4ValueArray *C4FindObject::FindMany(const C4ObjectList &Objs, const C4LSectors
 		C4ObjectList *pLst = Area.FirstObjectShapes(&pSct);
 		// Check if a single-sector check is enough
 		if (!Area.Next(pSct))
-			return FindMany(pSct->ObjectShapes);
+			return IsImpossibleInSector(pSct) ? new C4ValueArray() : FindMany(pSct->ObjectShapes);
 		// Set up array
 		pArray = new C4ValueArray(32); iSize = 0;
 		// Create marker, search all areas
 		uint32_t iMarker = ::Objects.GetNextMarker();
 		for (; pLst; pLst=Area.NextObjectShapes(pLst, &pSct))
-			for (C4Object *obj : *pLst)
-				if (obj->Status)
-					if (obj->Marker != iMarker)
-					{
-						obj->Marker = iMarker;
-						if (Check(obj))
+			if (!IsImpossibleInSector(pSct))
+				for (C4Object *obj : *pLst)
+					if (obj->Status)
+						if (obj->Marker != iMarker)
 						{
-							// Grow the array, if neccessary
-							if (iSize >= pArray->GetSize())
-								pArray->SetSize(iSize * 2);
-							// Add object
-							(*pArray)[iSize++] = C4VObj(obj);
+							obj->Marker = iMarker;
+							if (Check(obj))
+							{
+								// Grow the array, if neccessary
+								if (iSize >= pArray->GetSize())
+									pArray->SetSize(iSize * 2);
+								// Add object
+								(*pArray)[iSize++] = C4VObj(obj);
+							}
 						}
-					}
 	}
 	else
 	{
@@ -459,16 +462,17 @@ C4ValueArray *C4FindObject::FindMany(const C4ObjectList &Objs, const C4LSectors
 		// Search
 		C4LArea Area(&::Objects.Sectors, *pBounds); C4LSector *pSct;
 		for (C4ObjectList *pLst=Area.FirstObjects(&pSct); pLst; pLst=Area.NextObjects(pLst, &pSct))
-			for (C4Object *obj : *pLst)
-				if (obj->Status)
-					if (Check(obj))
-					{
-						// Grow the array, if neccessary
-						if (iSize >= pArray->GetSize())
-							pArray->SetSize(iSize * 2);
-						// Add object
-						(*pArray)[iSize++] = C4VObj(obj);
-					}
+			if (!IsImpossibleInSector(pSct))
+				for (C4Object *obj : *pLst)
+					if (obj->Status)
+						if (Check(obj))
+						{
+							// Grow the array, if neccessary
+							if (iSize >= pArray->GetSize())
+								pArray->SetSize(iSize * 2);
+							// Add object
+							(*pArray)[iSize++] = C4VObj(obj);
+						}
 	}
 	// Shrink array
 	pArray->SetSize(iSize);
@@ -552,6 +556,10 @@ C4FindObjectAnd::C4FindObjectAnd(int32_t inCnt, C4FindObject **ppConds, bool fFr
 			// the objects will be filtered out later
 		}
 	}
+	// Check cheap conditions first. This is done after collecting the bounds,
+	// because the first bounded condition decides how the sectors are searched.
+	std::stable_sort(ppConds, ppConds + iCnt, [](C4FindObject *a, C4FindObject *b) { return a->GetCost() < b->GetCost(); });
+	Cost = iCnt ? ppConds[iCnt - 1]->GetCost() : C4FOC_Field;
 }
 
 C4FindObjectAnd::~C4FindObjectAnd()
@@ -578,6 +586,14 @@ bool C4FindObjectAnd::IsImpossible()
 	return false;
 }
 
+bool C4FindObjectAnd::IsImpossibleInSector(const C4LSector *pSct)
+{
+	for (int32_t i = 0; i < iCnt; i++)
+		if (ppConds[i]->IsImpossibleInSector(pSct))
+			return true;
+	return false;
+}
+
 // *** C4FindObjectOr
 
 C4FindObjectOr::C4FindObjectOr(int32_t inCnt, C4FindObject **ppConds)
@@ -613,6 +629,9 @@ C4FindObjectOr::C4FindObjectOr(int32_t inCnt, C4FindObject **ppConds)
 			fHasBounds = true;
 		}
 	}
+	// Check cheap conditions first
+	std::stable_sort(ppConds, ppConds + iCnt, [](C4FindObject *a, C4FindObject *b) { return a->GetCost() < b->GetCost(); });
+	Cost = iCnt ? ppConds[iCnt - 1]->GetCost() : C4FOC_Field;
 }
 
 C4FindObjectOr::~C4FindObjectOr()
@@ -638,6 +657,14 @@ bool C4FindObjectOr::IsEnsured()
 	return false;
 }
 
+bool C4FindObjectOr::IsImpossibleInSector(const C4LSector *pSct)
+{
+	for (int32_t i = 0; i < iCnt; i++)
+		if (!ppConds[i]->IsImpossibleInSector(pSct))
+			return false;
+	return true;
+}
+
 // *** C4FindObject* (primitive conditions)
 
 bool C4FindObjectExclude::Check(C4Object *pObj)
@@ -707,6 +734,11 @@ bool C4FindObjectOCF::IsImpossible()
 	return !ocf;
 }
 
+bool C4FindObjectOCF::IsImpossibleInSector(const C4LSector *pSct)
+{
+	return !(pSct->OCFMask & ocf);
+}
+
 bool C4FindObjectCategory::Check(C4Object *pObj)
 {
 	return !! (pObj->Category & iCategory);
@@ -717,6 +749,11 @@ bool C4FindObjectCategory::IsEnsured()
 	return !iCategory;
 }
 
+bool C4FindObjectCategory::IsImpossibleInSector(const C4LSector *pSct)
+{
+	return iCategory && !(pSct->CategoryMask & iCategory);
+}
+
 bool C4FindObjectAction::Check(C4Object *pObj)
 {
 	assert(pObj);
@@ -65,6 +65,15 @@ enum C4SortObjectCondID
 	C4SO_Last         = 50  // no sort condition larger than this
 };
 
+// Rough cost of checking one object, so cheap conditions can be checked first
+enum C4FindObjectCost
+{
+	C4FOC_Field    = 0, // compares a member of the object
+	C4FOC_Geometry = 1, // position and shape tests
+	C4FOC_Lookup   = 2, // property and action lookups, array searches
+	C4FOC_Script   = 3  // script callbacks
+};
+
 // Base class
 class C4FindObject
 {
@@ -96,6 +105,8 @@ protected:
 	virtual bool UseShapes() { return false; }
 	virtual bool IsImpossible() { return false; }
 	virtual bool IsEnsured() { return false; }
+	virtual bool IsImpossibleInSector(const C4LSector *pSct) { return false; } // judging by the sector masks
+	virtual C4FindObjectCost GetCost() { return C4FOC_Field; }
 
 private:
 	void CheckObjectStatus(C4ValueArray *pArray);
@@ -114,6 +125,7 @@ protected:
 	bool Check(C4Object *pObj) override;
 	bool IsImpossible() override { return pCond->IsEnsured(); }
 	bool IsEnsured() override { return pCond->IsImpossible(); }
+	C4FindObjectCost GetCost() override { return pCond->GetCost(); }
 };
 
 class C4FindObjectAnd : public C4FindObject
@@ -125,12 +137,15 @@ private:
 	int32_t iCnt;
 	C4FindObject **ppConds; bool fFreeArray; bool fUseShapes;
 	C4Rect Bounds; bool fHasBounds;
+	C4FindObjectCost Cost;
 protected:
 	bool Check(C4Object *pObj) override;
 	C4Rect *GetBounds() override { return fHasBounds ? &Bounds : nullptr; }
 	bool UseShapes() override { return fUseShapes; }
 	bool IsEnsured() override { return !iCnt; }
 	bool IsImpossible() override;
+	bool IsImpossibleInSector(const C4LSector *pSct) override;
+	C4FindObjectCost GetCost() override { return Cost; }
 	void ForgetConditions() { ppConds=nullptr; iCnt=0; }
 };
 
@@ -152,12 +167,15 @@ private:
 	int32_t iCnt;
 	C4FindObject **ppConds; bool fUseShapes;
 	C4Rect Bounds; bool fHasBounds;
+	C4FindObjectCost Cost;
 protected:
 	bool Check(C4Object *pObj) override;
 	C4Rect *GetBounds() override { return fHasBounds ? &Bounds : nullptr; }
 	bool UseShapes() override { return fUseShapes; }
 	bool IsEnsured() override;
 	bool IsImpossible() override { return !iCnt; }
+	bool IsImpossibleInSector(const C4LSector *pSct) override;
+	C4FindObjectCost GetCost() override { return Cost; }
 };
 
 // Primitive conditions
@@ -194,6 +212,7 @@ private:
 protected:
 	bool Check(C4Object *pObj) override;
 	C4Rect *GetBounds() override { return &rect; }
+	C4FindObjectCost GetCost() override { return C4FOC_Geometry; }
 	bool IsImpossible() override;
 };
 
@@ -207,6 +226,7 @@ private:
 protected:
 	bool Check(C4Object *pObj) override;
 	C4Rect *GetBounds() override { return &bounds; }
+	C4FindObjectCost GetCost() override { return C4FOC_Geometry; }
 	bool UseShapes() override { return true; }
 };
 
@@ -220,6 +240,7 @@ private:
 protected:
 	bool Check(C4Object *pObj) override;
 	C4Rect *GetBounds() override { return &bounds; }
+	C4FindObjectCost GetCost() override { return C4FOC_Geometry; }
 	bool UseShapes() override { return true; }
 };
 
@@ -234,6 +255,7 @@ private:
 protected:
 	bool Check(C4Object *pObj) override;
 	C4Rect *GetBounds() override { return &bounds; }
+	C4FindObjectCost GetCost() override { return C4FOC_Geometry; }
 	bool UseShapes() override { return true; }
 };
 
@@ -248,6 +270,7 @@ private:
 protected:
 	bool Check(C4Object *pObj) override;
 	C4Rect *GetBounds() override { return &bounds; }
+	C4FindObjectCost GetCost() override { return C4FOC_Geometry; }
 };
 
 class C4FindObjectCone : public C4FindObject
@@ -261,6 +284,7 @@ private:
 protected:
 	bool Check(C4Object *pObj) override;
 	C4Rect *GetBounds() override { return &bounds; }
+	C4FindObjectCost GetCost() override { return C4FOC_Geometry; }
 };
 
 class C4FindObjectOCF : public C4FindObject
@@ -273,6 +297,7 @@ private:
 protected:
 	bool Check(C4Object *pObj) override;
 	bool IsImpossible() override;
+	bool IsImpossibleInSector(const C4LSector *pSct) override;
 };
 
 class C4FindObjectCategory : public C4FindObject
@@ -285,6 +310,7 @@ private:
 protected:
 	bool Check(C4Object *pObj) override;
 	bool IsEnsured() override;
+	bool IsImpossibleInSector(const C4LSector *pSct) override;
 };
 
 class C4FindObjectAction : public C4FindObject
@@ -296,6 +322,7 @@ private:
 	const char *szAction;
 protected:
 	bool Check(C4Object *pObj) override;
+	C4FindObjectCost GetCost() override { return C4FOC_Lookup; }
 };
 
 class C4FindObjectActionTarget : public C4FindObject
@@ -308,6 +335,7 @@ private:
 	int index;
 protected:
 	bool Check(C4Object *pObj) override;
+	C4FindObjectCost GetCost() override { return C4FOC_Lookup; }
 };
 
 class C4FindObjectProcedure : public C4FindObject
@@ -319,6 +347,7 @@ private:
 	C4String * procedure;
 protected:
 	bool Check(C4Object *pObj) override;
+	C4FindObjectCost GetCost() override { return C4FOC_Lookup; }
 	bool IsImpossible() override;
 };
 
@@ -375,6 +404,7 @@ private:
 	C4AulParSet Pars;
 protected:
 	bool Check(C4Object *pObj) override;
+	C4FindObjectCost GetCost() override { return C4FOC_Script; }
 	bool IsImpossible() override;
 };
 
@@ -390,6 +420,7 @@ private:
 	C4Value Value;
 protected:
 	bool Check(C4Object *pObj) override;
+	C4FindObjectCost GetCost() override { return C4FOC_Lookup; }
 	bool IsImpossible() override;
 };
 
@@ -412,6 +443,7 @@ private:
 	C4ValueArray *pArray;
 protected:
 	bool Check(C4Object *pObj) override;
+	C4FindObjectCost GetCost() override { return C4FOC_Lookup; }
 	bool IsImpossible() override;
 };
 
@@ -86,6 +86,21 @@ C4ObjectList &C4GameObjects::ObjectsAt(int ix, int iy)
 	return Sectors.SectorAt(ix, iy)->ObjectShapes;
 }
 
+#ifdef _DEBUG
+bool C4GameObjects::SectorsHaveCrossCheckTarget(C4Object *obj1, DWORD tocf)
+{
+	C4LSector *pSct;
+	for (C4ObjectList *pLst = obj1->Area.FirstObjects(&pSct); pLst; pLst = obj1->Area.NextObjects(pLst, &pSct))
+		for (C4Object* obj2 : *pLst)
+			if ((obj2 != obj1) && obj2->Status && !obj2->Contained && (obj2->OCF & tocf) &&
+			    Inside<int32_t>(obj2->GetX() - (obj1->GetX() + obj1->Shape.x), 0, obj1->Shape.Wdt - 1) &&
+			    Inside<int32_t>(obj2->GetY() - (obj1->GetY() + obj1->Shape.y), 0, obj1->Shape.Hgt - 1) &&
+			    obj1->Layer == obj2->Layer)
+				return true;
+	return false;
+}
+#endif
+
 void C4GameObjects::CrossCheck() // Every Tick1 by ExecObjects
 {
 	DWORD focf,tocf;
@@ -98,9 +113,18 @@ void C4GameObjects::CrossCheck() // Every Tick1 by ExecObjects
 		tocf |= OCF_Carryable;
 	focf |= OCF_Collection; focf |= OCF_Alive; tocf |= OCF_HitSpeed2;
 
+	// Broadphase: Objects that have no possible target in their shape are skipped
+	auto is_target = [tocf](C4Object *obj) { return obj->Status && !obj->Contained && (obj->OCF & tocf); };
+	CrossCheckTargets.Reset();
+
 	for (C4Object* obj1 : *this)
 		if (obj1->Status && !obj1->Contained && (obj1->OCF & focf))
 		{
+			if (CrossCheckTargets.CanSkip(obj1, *this, is_target))
+			{
+				assert(!SectorsHaveCrossCheckTarget(obj1, tocf));
+				continue;
+			}
 			uint32_t Marker = GetNextMarker();
 			C4LSector *pSct;
 			for (C4ObjectList *pLst = obj1->Area.FirstObjects(&pSct); pLst; pLst = obj1->Area.NextObjects(pLst, &pSct))
@@ -119,22 +143,26 @@ void C4GameObjects::CrossCheck() // Every Tick1 by ExecObjects
 							C4Real dXDir = obj2->xdir - obj1->xdir, dYDir = obj2->ydir - obj1->ydir;
 							C4Real speed = dXDir * dXDir + dYDir * dYDir;
 							// Only hit if obj2's speed and relative speeds are larger than HitSpeed2
-							if ((obj2->OCF & OCF_HitSpeed2) && speed > HitSpeed2 &&
-							   !obj1->Call(PSF_QueryCatchBlow, &C4AulParSet(obj2)))
+							if ((obj2->OCF & OCF_HitSpeed2) && speed > HitSpeed2)
 							{
-								int32_t iHitEnergy = fixtoi(speed * obj2->Mass / 5);
-								// Hit energy reduced to 1/3rd, but do not drop to zero because of this division
-								iHitEnergy = std::max<int32_t>(iHitEnergy/3, !!iHitEnergy);
-								obj1->DoEnergy(-iHitEnergy / 5, false, C4FxCall_EngObjHit, obj2->Controller);
-								int tmass = std::max<int32_t>(obj1->Mass, 50);
-								C4PropList* pActionDef = obj1->GetAction();
-								if (!::Game.iTick3 || (pActionDef && pActionDef->GetPropertyP(P_Procedure) != DFA_FLIGHT))
-									obj1->Fling(obj2->xdir * 50 / tmass, -Abs(obj2->ydir / 2) * 50 / tmass, false);
-								obj1->Call(PSF_CatchBlow, &C4AulParSet(-iHitEnergy / 5, obj2));
-								// obj1 might have been tampered with
-								if (!obj1->Status || obj1->Contained || !(obj1->OCF & focf))
-									goto out1;
-								continue;
+								// anything may happen in the callbacks
+								CrossCheckTargets.Invalidate();
+								if (!obj1->Call(PSF_QueryCatchBlow, &C4AulParSet(obj2)))
+								{
+									int32_t iHitEnergy = fixtoi(speed * obj2->Mass / 5);
+									// Hit energy reduced to 1/3rd, but do not drop to zero because of this division
+									iHitEnergy = std::max<int32_t>(iHitEnergy/3, !!iHitEnergy);
+									obj1->DoEnergy(-iHitEnergy / 5, false, C4FxCall_EngObjHit, obj2->Controller);
+									int tmass = std::max<int32_t>(obj1->Mass, 50);
+									C4PropList* pActionDef = obj1->GetAction();
+									if (!::Game.iTick3 || (pActionDef && pActionDef->GetPropertyP(P_Procedure) != DFA_FLIGHT))
+										obj1->Fling(obj2->xdir * 50 / tmass, -Abs(obj2->ydir / 2) * 50 / tmass, false);
+									obj1->Call(PSF_CatchBlow, &C4AulParSet(-iHitEnergy / 5, obj2));
+									// obj1 might have been tampered with
+									if (!obj1->Status || obj1->Contained || !(obj1->OCF & focf))
+										goto out1;
+									continue;
+								}
 							}
 						}
 						// Collection
@@ -142,6 +170,7 @@ void C4GameObjects::CrossCheck() // Every Tick1 by ExecObjects
 						    Inside<int32_t>(obj2->GetX() - (obj1->GetX() + obj1->Def->Collection.x), 0, obj1->Def->Collection.Wdt - 1) &&
 						    Inside<int32_t>(obj2->GetY() - (obj1->GetY() + obj1->Def->Collection.y), 0, obj1->Def->Collection.Hgt - 1))
 						{
+							CrossCheckTargets.Invalidate();
 							obj1->Collect(obj2);
 							// obj1 might have been tampered with
 							if (!obj1->Status || obj1->Contained || !(obj1->OCF & focf))
@@ -18,6 +18,7 @@
 #ifndef INC_C4GameObjects
 #define INC_C4GameObjects
 
+#include "object/C4CrossCheckTargets.h"
 #include "object/C4FindObject.h"
 #include "object/C4ObjectList.h"
 #include "object/C4Sector.h"
@@ -37,6 +38,11 @@ public:
 
 private:
 	uint32_t LastUsedMarker; // last used value for C4Object::Marker
+	C4CrossCheckTargets<C4Object> CrossCheckTargets; // used by CrossCheck only
+
+#ifdef _DEBUG
+	bool SectorsHaveCrossCheckTarget(C4Object *obj1, DWORD tocf);
+#endif
 
 public:
 	C4LSectors Sectors; // section object lists
@@ -754,6 +754,8 @@ void C4Object::SetOCF()
 		C4RCOCF rc = { dwOCFOld, OCF, false };
 		AddDbgRec(RCT_OCF, &rc, sizeof(rc));
 	}
+	// Category might have changed as well
+	::Objects.Sectors.UpdateObjectMasks(this);
 }
 
 
@@ -826,6 +828,8 @@ void C4Object::UpdateOCF()
 		C4RCOCF rc = { dwOCFOld, OCF, true };
 		AddDbgRec(RCT_OCF, &rc, sizeof(rc));
 	}
+	if (OCF & ~dwOCFOld)
+		::Objects.Sectors.UpdateObjectMasks(this);
 #ifdef _DEBUG
 	DEBUGREC_OFF
 	uint32_t updateOCF = OCF;
@@ -29,6 +29,37 @@
 
 static const C4ObjectLink NULL_LINK = { nullptr, nullptr, nullptr };
 
+// Links are handed out from chunks shared by all lists, so links that are
+// created together lie next to each other in memory and freed links are
+// reused right away instead of going through the heap.
+// Chunks are never returned; global lists may still be cleared on exit.
+static const size_t LinkChunkSize = 1024;
+static C4ObjectLink *FreeLinks = nullptr;
+
+static C4ObjectLink *NewLink()
+{
+	if (!FreeLinks)
+	{
+		// Chain a new chunk into the free list in ascending order
+		C4ObjectLink *pChunk = new C4ObjectLink[LinkChunkSize];
+		for (size_t i = 0; i + 1 < LinkChunkSize; ++i)
+			pChunk[i].Next = &pChunk[i + 1];
+		pChunk[LinkChunkSize - 1].Next = nullptr;
+		FreeLinks = pChunk;
+	}
+	C4ObjectLink *pLnk = FreeLinks;
+	FreeLinks = pLnk->Next;
+	pLnk->Obj = nullptr; pLnk->Prev = pLnk->Next = nullptr;
+	return pLnk;
+}
+
+static void DeleteLink(C4ObjectLink *pLnk)
+{
+	pLnk->Obj = nullptr; pLnk->Prev = nullptr;
+	pLnk->Next = FreeLinks;
+	FreeLinks = pLnk;
+}
+
 C4ObjectList::C4ObjectList()
 {
 	Default();
@@ -49,7 +80,7 @@ void C4ObjectList::Clear()
 {
 	C4ObjectLink *cLnk,*nextLnk;
 	for (cLnk=First; cLnk; cLnk=nextLnk)
-		{ nextLnk=cLnk->Next; delete cLnk; }
+		{ nextLnk=cLnk->Next; DeleteLink(cLnk); }
 	First=Last=nullptr;
 	if (pEnumerated)
 	{
@@ -141,7 +172,7 @@ bool C4ObjectList::Add(C4Object *nObj, SortType eSort, C4ObjectList *pLstSorted)
 	assert(pLstSorted != this);
 
 	// Allocate new link
-	if (!(nLnk=new C4ObjectLink)) return false;
+	nLnk=NewLink();
 	// Set link
 	nLnk->Obj=nObj;
 
@@ -281,7 +312,7 @@ bool C4ObjectList::Remove(C4Object *pObj)
 	RemoveLink(cLnk);
 
 	// Deallocate link
-	delete cLnk;
+	DeleteLink(cLnk);
 
 	// Remove mass
 	Mass-=pObj->Mass; if (Mass<0) Mass=0;
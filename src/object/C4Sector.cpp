@@ -51,6 +51,22 @@ void C4LSector::ClearObjects()
 	// clear objects
 	Objects.Clear();
 	ObjectShapes.Clear();
+	CategoryMask = OCFMask = 0;
+}
+
+void C4LSector::AddToMasks(C4Object *pObj)
+{
+	CategoryMask |= pObj->Category;
+	OCFMask |= pObj->OCF;
+}
+
+void C4LSector::UpdateMasks()
+{
+	CategoryMask = OCFMask = 0;
+	for (C4Object *pObj : Objects)
+		AddToMasks(pObj);
+	for (C4Object *pObj : ObjectShapes)
+		AddToMasks(pObj);
 }
 
 /* sector map */
@@ -94,6 +110,7 @@ void C4LSectors::Add(C4Object *pObj, C4ObjectList *pMainList)
 	// Add to owning sector
 	C4LSector *pSct = SectorAt(pObj->GetX(), pObj->GetY());
 	pSct->Objects.Add(pObj, C4ObjectList::stMain, pMainList);
+	pSct->AddToMasks(pObj);
 	// Save position
 	pObj->old_x = pObj->GetX(); pObj->old_y = pObj->GetY();
 	// Add to all sectors in shape area
@@ -101,6 +118,7 @@ void C4LSectors::Add(C4Object *pObj, C4ObjectList *pMainList)
 	for (pSct = pObj->Area.First(); pSct; pSct = pObj->Area.Next(pSct))
 	{
 		pSct->ObjectShapes.Add(pObj, C4ObjectList::stMain, pMainList);
+		pSct->AddToMasks(pObj);
 	}
 	if (Config.General.DebugRec)
 		pObj->Area.DebugRec(pObj, 'A');
@@ -125,6 +143,7 @@ void C4LSectors::Update(C4Object *pObj, C4ObjectList *pMainList)
 		{
 			pOld->Objects.Remove(pObj);
 			pNew->Objects.Add(pObj, C4ObjectList::stMain, pMainList);
+			pNew->AddToMasks(pObj);
 		}
 		// Save position
 		pObj->old_x = pObj->GetX(); pObj->old_y = pObj->GetY();
@@ -141,6 +160,7 @@ void C4LSectors::Update(C4Object *pObj, C4ObjectList *pMainList)
 		if (!pObj->Area.Contains(pNew))
 		{
 			pNew->ObjectShapes.Add(pObj, C4ObjectList::stMain, pMainList);
+			pNew->AddToMasks(pObj);
 		}
 	// Update area
 	pObj->Area = NewArea;
@@ -182,6 +202,23 @@ void C4LSectors::Remove(C4Object *pObj)
 		pObj->Area.DebugRec(pObj, 'R');
 }
 
+void C4LSectors::UpdateObjectMasks(C4Object *pObj)
+{
+	// Only objects that have been added know their sectors
+	if (!Sectors || pObj->Area.IsNull()) return;
+	SectorAt(pObj->old_x, pObj->old_y)->AddToMasks(pObj);
+	for (C4LSector *pSct = pObj->Area.First(); pSct; pSct = pObj->Area.Next(pSct))
+		pSct->AddToMasks(pObj);
+}
+
+void C4LSectors::UpdateMasks()
+{
+	if (!Sectors) return;
+	for (int cnt=0; cnt<Size; cnt++)
+		Sectors[cnt].UpdateMasks();
+	SectorOut.UpdateMasks();
+}
+
 void C4LSectors::AssertObjectNotInList(C4Object *pObj)
 {
 #ifndef NDEBUG
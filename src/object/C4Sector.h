@@ -48,8 +48,14 @@ public:
 	C4ObjectList Objects; // objects within this sector
 	C4ObjectList ObjectShapes; // objects with shapes that overlap this sector
 
+	// all categories and OCFs of the objects in the lists above, so searches can skip the sector
+	// may contain flags that no object in the sector has anymore until UpdateMasks is called
+	uint32_t CategoryMask{0}, OCFMask{0};
+
 	void CompileFunc(StdCompiler *pComp, C4ValueNumbers * numbers);
 	void ClearObjects(); // remove all objects from object lists
+	void AddToMasks(C4Object *pObj);
+	void UpdateMasks(); // recalculate masks from the object lists
 
 	friend class C4LSectors;
 };
@@ -73,6 +79,8 @@ public:
 	void Update(C4Object *pObj, C4ObjectList *pMainList); // does not update object order!
 	void Remove(C4Object *pObj);
 	void ClearObjects(); // remove all objects from object lists
+	void UpdateObjectMasks(C4Object *pObj); // object gained categories or OCFs
+	void UpdateMasks(); // drop flags of objects that left or lost them
 
 	void AssertObjectNotInList(C4Object *pObj); // searches all sector lists for object, and assert if it's inside a list
 
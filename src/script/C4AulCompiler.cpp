@@ -189,6 +189,7 @@ class C4AulCompiler::CodegenAstVisitor : public ::aul::DefaultRecursiveVisitor
 
 	int32_t stack_height = 0;
 	bool at_jump_target = false;
+	int last_jump_target = -1; // code position of the most recent jump target
 
 	struct Loop
 	{
@@ -218,7 +219,9 @@ class C4AulCompiler::CodegenAstVisitor : public ::aul::DefaultRecursiveVisitor
 	
 	constexpr static bool IsJump(C4AulBCCType t)
 	{
-		return t == AB_JUMP || t == AB_JUMPAND || t == AB_JUMPOR || t == AB_JUMPNNIL || t == AB_CONDN || t == AB_COND;
+		return t == AB_JUMP || t == AB_JUMPAND || t == AB_JUMPOR || t == AB_JUMPNNIL || t == AB_CONDN || t == AB_COND ||
+			t == AB_CONDN_LessThan || t == AB_CONDN_LessThanEqual || t == AB_CONDN_GreaterThan ||
+			t == AB_CONDN_GreaterThanEqual || t == AB_CONDN_Equal || t == AB_CONDN_NotEqual;
 	}
 
 	int AddJumpTarget();
@@ -713,6 +716,7 @@ int C4AulCompiler::CodegenAstVisitor::GetStackValue(C4AulBCCType eType, intptr_t
 	case AB_DUP:
 	case AB_DUP_CONTEXT:
 	case AB_THIS:
+	case AB_THIS_PROP:
 		return 1;
 
 	case AB_Pow:
@@ -782,6 +786,19 @@ int C4AulCompiler::CodegenAstVisitor::GetStackValue(C4AulBCCType eType, intptr_t
 	case AB_ARRAY_SLICE:
 		return -2;
 
+	case AB_CONDN_LessThan:
+	case AB_CONDN_LessThanEqual:
+	case AB_CONDN_GreaterThan:
+	case AB_CONDN_GreaterThanEqual:
+	case AB_CONDN_Equal:
+	case AB_CONDN_NotEqual:
+		return -2;
+
+	case AB_DUP_Sum:
+	case AB_DUP_Sub:
+	case AB_DUP_Mul:
+		return 0;
+
 	case AB_ARRAY_SLICE_SET:
 		return -3;
 	}
@@ -885,10 +902,47 @@ int C4AulCompiler::CodegenAstVisitor::AddBCC(const char *TokenSPos, C4AulBCCType
 			return Fn->GetCodePos() - 1;
 		}
 
+		// Join DUP + Sum/Sub/Mul to DUP_Sum/DUP_Sub/DUP_Mul
+		if ((eType == AB_Sum || eType == AB_Sub || eType == AB_Mul) && pCPos1->bccType == AB_DUP)
+		{
+			pCPos1->bccType = eType == AB_Sum ? AB_DUP_Sum : eType == AB_Sub ? AB_DUP_Sub : AB_DUP_Mul;
+			return Fn->GetCodePos() - 1;
+		}
+
+		// Join comparison + CONDN to a single compare-and-branch
+		if (eType == AB_CONDN)
+		{
+			C4AulBCCType eFused = AB_CONDN;
+			switch (pCPos1->bccType)
+			{
+			case AB_LessThan: eFused = AB_CONDN_LessThan; break;
+			case AB_LessThanEqual: eFused = AB_CONDN_LessThanEqual; break;
+			case AB_GreaterThan: eFused = AB_CONDN_GreaterThan; break;
+			case AB_GreaterThanEqual: eFused = AB_CONDN_GreaterThanEqual; break;
+			case AB_Equal: eFused = AB_CONDN_Equal; break;
+			case AB_NotEqual: eFused = AB_CONDN_NotEqual; break;
+			default: break;
+			}
+			if (eFused != AB_CONDN)
+			{
+				pCPos1->bccType = eFused;
+				pCPos1->Par.i = X + 1;
+				return Fn->GetCodePos() - 1;
+			}
+		}
+
 		// Join AB_STRING + AB_ARRAYA to AB_PROP
 		if (eType == AB_ARRAYA && pCPos1->bccType == AB_STRING)
 		{
 			pCPos1->bccType = AB_PROP;
+			// Join AB_THIS + AB_PROP to AB_THIS_PROP, unless the string is a jump target
+			// as in (o ?? this).x
+			if (Fn->GetCodePos() >= 2 && pCPos1[-1].bccType == AB_THIS && Fn->GetCodePos() - 1 != last_jump_target)
+			{
+				pCPos1[-1] = *pCPos1;
+				pCPos1[-1].bccType = AB_THIS_PROP;
+				Fn->RemoveLastBCC();
+			}
 			return Fn->GetCodePos() - 1;
 		}
 
@@ -928,6 +982,14 @@ int C4AulCompiler::CodegenAstVisitor::AddBCC(const char *SPos, const C4AulBCC &b
 C4AulBCC C4AulCompiler::CodegenAstVisitor::MakeSetter(const char *SPos, bool fLeaveValue)
 {
 	assert(Fn);
+	// Split AB_THIS_PROP again, since the setter needs this on the stack
+	if (Fn->GetLastCode()->bccType == AB_THIS_PROP)
+	{
+		C4AulBCC Prop = *(Fn->GetLastCode());
+		Prop.bccType = AB_PROP;
+		*(Fn->GetLastCode()) = C4AulBCC(AB_THIS, 0);
+		Fn->AddBCC(AB_PROP, Prop.Par.X, SPos);
+	}
 	C4AulBCC Value = *(Fn->GetLastCode()), Setter = Value;
 	// Check type
 	switch (Value.bccType)
@@ -988,6 +1050,7 @@ int C4AulCompiler::CodegenAstVisitor::AddJumpTarget()
 		throw C4AulParseError(host, "internal error: jump target outside of function");
 
 	at_jump_target = true;
+	last_jump_target = Fn->GetCodePos();
 	return Fn->GetCodePos();
 }
 
@@ -18,6 +18,7 @@
 #include "C4Include.h"
 #include "script/C4AulExec.h"
 
+#include "c4group/C4Language.h"
 #include "control/C4Record.h"
 #include "object/C4Def.h"
 #include "object/C4Object.h"
@@ -460,6 +461,89 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos)
 				break;
 			}
 
+			// superinstructions
+			case AB_DUP_Sum: // +
+			{
+				C4Value *pPar1 = pCurVal, *pPar2 = pCurVal + pCPos->Par.i;
+				CheckOpPars(pPar1, pPar2, C4V_Int, C4V_Int, "+");
+				pPar1->SetInt(pPar1->_getInt() + pPar2->_getInt());
+				break;
+			}
+			case AB_DUP_Sub: // -
+			{
+				C4Value *pPar1 = pCurVal, *pPar2 = pCurVal + pCPos->Par.i;
+				CheckOpPars(pPar1, pPar2, C4V_Int, C4V_Int, "-");
+				pPar1->SetInt(pPar1->_getInt() - pPar2->_getInt());
+				break;
+			}
+			case AB_DUP_Mul: // *
+			{
+				C4Value *pPar1 = pCurVal, *pPar2 = pCurVal + pCPos->Par.i;
+				CheckOpPars(pPar1, pPar2, C4V_Int, C4V_Int, "*");
+				pPar1->SetInt(pPar1->_getInt() * pPar2->_getInt());
+				break;
+			}
+			case AB_CONDN_LessThan: // <
+				CheckOpPars(C4V_Int, C4V_Int, "<");
+				if (!(pCurVal[-1]._getInt() < pCurVal[0]._getInt()))
+				{
+					fJump = true;
+					pCPos += pCPos->Par.i;
+				}
+				PopValues(2);
+				break;
+			case AB_CONDN_LessThanEqual: // <=
+				CheckOpPars(C4V_Int, C4V_Int, "<=");
+				if (!(pCurVal[-1]._getInt() <= pCurVal[0]._getInt()))
+				{
+					fJump = true;
+					pCPos += pCPos->Par.i;
+				}
+				PopValues(2);
+				break;
+			case AB_CONDN_GreaterThan: // >
+				CheckOpPars(C4V_Int, C4V_Int, ">");
+				if (!(pCurVal[-1]._getInt() > pCurVal[0]._getInt()))
+				{
+					fJump = true;
+					pCPos += pCPos->Par.i;
+				}
+				PopValues(2);
+				break;
+			case AB_CONDN_GreaterThanEqual: // >=
+				CheckOpPars(C4V_Int, C4V_Int, ">=");
+				if (!(pCurVal[-1]._getInt() >= pCurVal[0]._getInt()))
+				{
+					fJump = true;
+					pCPos += pCPos->Par.i;
+				}
+				PopValues(2);
+				break;
+			case AB_CONDN_Equal: // ==
+				if (!pCurVal[-1].IsIdenticalTo(pCurVal[0]))
+				{
+					fJump = true;
+					pCPos += pCPos->Par.i;
+				}
+				PopValues(2);
+				break;
+			case AB_CONDN_NotEqual: // !=
+				if (pCurVal[-1].IsIdenticalTo(pCurVal[0]))
+				{
+					fJump = true;
+					pCPos += pCPos->Par.i;
+				}
+				PopValues(2);
+				break;
+			case AB_THIS_PROP:
+				// same semantics as AB_THIS followed by AB_PROP
+				if (!pCurCtx->Obj || !pCurCtx->Obj->Status)
+					throw C4AulExecError("proplist access: proplist expected, got nil");
+				PushNullVals(1);
+				if (!pCurCtx->Obj->GetPropertyByS(pCPos->Par.s, pCurVal))
+					pCurVal->Set0();
+				break;
+
 			case AB_NEW_ARRAY:
 			{
 				// Create array
@@ -759,7 +843,7 @@ C4Value C4AulExec::Exec(C4AulBCC *pCPos)
 					throw C4AulExecError(FormatString("'->': invalid target type %s, expected proplist", pTargetVal->GetTypeName()).getData());
 
 				// Search function for given context
-				C4AulFunc * pFunc = pDest->GetFunc(pCPos->Par.s);
+				C4AulFunc * pFunc = pDest->GetFunc(pCPos->Par.s, pCurCtx->Func->GetCallCache(pCPos));
 				if (!pFunc && pCPos->bccType == AB_CALLFS)
 				{
 					PopValuesUntil(pTargetVal);
@@ -908,7 +992,7 @@ void C4AulExec::StartTrace()
 		iTraceStart = ContextStackSize();
 }
 
-void C4AulExec::StartProfiling(C4ScriptHost *pProfiledScript)
+void C4AulExec::StartProfiling(C4ScriptHost *pProfiledScript, bool fRecordStacks)
 {
 	// stop previous profiler run
 	if (fProfiling) StopProfiling();
@@ -920,6 +1004,13 @@ void C4AulExec::StartProfiling(C4ScriptHost *pProfiledScript)
 	tDirectExecTotal = 0;
 	for (C4AulScriptContext *pCtx = Contexts; pCtx <= pCurCtx; ++pCtx)
 		pCtx->tTime = tNow;
+	// call stacks that are already running are attributed from now on
+	if (fRecordStacks)
+	{
+		StackProfiler = std::make_unique<C4AulStackProfiler>();
+		for (C4AulScriptContext *pCtx = Contexts; pCtx <= pCurCtx; ++pCtx)
+			StackProfiler->Enter(pCtx->Func);
+	}
 }
 
 void C4AulExec::PushContext(const C4AulScriptContext &rContext)
@@ -936,6 +1027,7 @@ void C4AulExec::PushContext(const C4AulScriptContext &rContext)
 	}
 	// Profiler: Safe time to measure difference afterwards
 	if (fProfiling) pCurCtx->tTime = C4TimeMilliseconds::Now();
+	if (StackProfiler) StackProfiler->Enter(pCurCtx->Func);
 }
 
 void C4AulExec::PopContext()
@@ -949,6 +1041,7 @@ void C4AulExec::PopContext()
 		if (pCurCtx->Func)
 			pCurCtx->Func->tProfileTime += dt;
 	}
+	if (StackProfiler) StackProfiler->Leave();
 	// Trace done?
 	if (iTraceStart >= 0)
 	{
@@ -960,18 +1053,19 @@ void C4AulExec::PopContext()
 	pCurCtx--;
 }
 
-void C4AulProfiler::StartProfiling(C4ScriptHost *pScript)
+void C4AulProfiler::StartProfiling(C4ScriptHost *pScript, bool fRecordStacks)
 {
-	AulExec.StartProfiling(pScript);
+	AulExec.StartProfiling(pScript, fRecordStacks);
 	if(pScript)
 		ResetTimes(pScript->GetPropList());
 	else
 		ResetTimes();
 }
 
-void C4AulProfiler::StopProfiling()
+void C4AulProfiler::StopProfiling(const char *szStackFilename)
 {
 	if (!AulExec.IsProfiling()) return;
+	std::unique_ptr<C4AulStackProfiler> StackProfiler(std::move(AulExec.StackProfiler));
 	AulExec.StopProfiling();
 	// collect profiler times
 	C4AulProfiler Profiler;
@@ -981,6 +1075,17 @@ void C4AulProfiler::StopProfiling()
 	else
 		Profiler.CollectTimes();
 	Profiler.Show();
+	// call stacks are only written to a file on local request. Scripts get the heaviest ones in the log.
+	if (StackProfiler)
+	{
+		StackProfiler->Finish();
+		if (!szStackFilename)
+			StackProfiler->Show();
+		else if (StackProfiler->Save(szStackFilename))
+			LogF(LoadResStr("IDS_MSG_SCRIPTCALLSTACKSSAVED"), szStackFilename);
+		else
+			LogF(LoadResStr("IDS_ERR_SAVE_SCRIPTCALLSTACKS"), szStackFilename);
+	}
 }
 
 void C4AulProfiler::CollectEntry(C4AulScriptFunc *pFunc, uint32_t tProfileTime)
@@ -1010,6 +1115,128 @@ void C4AulProfiler::Show()
 	// done!
 }
 
+C4AulStackProfiler::C4AulStackProfiler(): tStart(std::chrono::steady_clock::now())
+{
+	Nodes.emplace_back();
+	Nodes[0].iParent = 0;
+}
+
+void C4AulStackProfiler::Enter(C4AulScriptFunc *pFunc)
+{
+	// find or add the node for this function below the current one
+	size_t iParent = Stack.empty() ? 0 : Stack.back().iNode;
+	size_t iNode;
+	auto i = Children.find(std::make_pair(iParent, pFunc));
+	if (i != Children.end())
+	{
+		iNode = i->second;
+	}
+	else
+	{
+		iNode = Nodes.size();
+		Nodes.emplace_back();
+		Nodes[iNode].iParent = iParent;
+		if (pFunc && pFunc->GetName())
+			Nodes[iNode].Name.Copy(pFunc->GetFullName());
+		else
+			Nodes[iNode].Name.Copy("Direct exec");
+		Children[std::make_pair(iParent, pFunc)] = iNode;
+	}
+	Stack.push_back({iNode, Now()});
+}
+
+void C4AulStackProfiler::Leave()
+{
+	if (Stack.empty()) return;
+	Frame f = Stack.back();
+	Stack.pop_back();
+	uint64_t tDuration = Now() - f.tStart;
+	Nodes[f.iNode].tTotal += tDuration;
+	Nodes[Nodes[f.iNode].iParent].tCallees += tDuration;
+	if (Calls.size() < MaxCalls)
+		Calls.push_back({f.iNode, f.tStart, tDuration});
+	else
+		++iDroppedCalls;
+}
+
+void C4AulStackProfiler::Finish()
+{
+	while (!Stack.empty()) Leave();
+}
+
+StdStrBuf C4AulStackProfiler::GetStackName(size_t iNode) const
+{
+	std::vector<size_t> Path;
+	for (; iNode; iNode = Nodes[iNode].iParent)
+		Path.push_back(iNode);
+	StdStrBuf r;
+	for (auto i = Path.rbegin(); i != Path.rend(); ++i)
+	{
+		if (i != Path.rbegin()) r.AppendChar(';');
+		r.Append(Nodes[*i].Name);
+	}
+	return r;
+}
+
+void C4AulStackProfiler::Show() const
+{
+	// log the call stacks with the most self time
+	std::vector<std::pair<uint64_t, size_t>> Stacks;
+	for (size_t i = 1; i < Nodes.size(); ++i)
+		Stacks.emplace_back(Nodes[i].tTotal - Nodes[i].tCallees, i);
+	size_t iCount = std::min<size_t>(Stacks.size(), 10);
+	std::partial_sort(Stacks.begin(), Stacks.begin() + iCount, Stacks.end(), std::greater<std::pair<uint64_t, size_t>>());
+	Log("Heaviest script call stacks:");
+	Log("==============================");
+	for (size_t i = 0; i < iCount; ++i)
+		LogF("%06luus\t%s", (unsigned long) (Stacks[i].first / 1000), GetStackName(Stacks[i].second).getData());
+	Log("==============================");
+}
+
+bool C4AulStackProfiler::Save(const char *szFilename) const
+{
+	if (SEqualNoCase(GetExtension(szFilename), "json"))
+		return SaveChromeTrace(szFilename);
+	return SaveCollapsedStacks(szFilename);
+}
+
+bool C4AulStackProfiler::SaveCollapsedStacks(const char *szFilename) const
+{
+	// one line per call stack with its self time in microseconds, as read by flamegraph tools
+	StdStrBuf Out;
+	for (size_t i = 1; i < Nodes.size(); ++i)
+	{
+		uint64_t tSelf = (Nodes[i].tTotal - Nodes[i].tCallees) / 1000;
+		if (!tSelf) continue;
+		Out.Append(GetStackName(i));
+		Out.AppendFormat(" %llu\n", (unsigned long long) tSelf);
+	}
+	return Out.SaveToFile(szFilename);
+}
+
+bool C4AulStackProfiler::SaveChromeTrace(const char *szFilename) const
+{
+	// complete events in the trace event format, times in microseconds
+	std::vector<StdCopyStrBuf> Names(Nodes.size());
+	for (size_t i = 1; i < Nodes.size(); ++i)
+	{
+		Names[i].Copy(Nodes[i].Name);
+		Names[i].EscapeString();
+	}
+	StdStrBuf Out;
+	Out.Append("{\"traceEvents\":[");
+	for (size_t i = 0; i < Calls.size(); ++i)
+	{
+		const Call &c = Calls[i];
+		Out.AppendFormat("%s\n{\"name\":\"%s\",\"cat\":\"script\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}",
+			i ? "," : "", Names[c.iNode].getData(), c.tStart / 1000.0, c.tDuration / 1000.0);
+	}
+	Out.Append("\n],\"displayTimeUnit\":\"ns\"}\n");
+	if (iDroppedCalls)
+		LogF("Script profiler: %lu calls exceeded the trace limit and are missing", (unsigned long) iDroppedCalls);
+	return Out.SaveToFile(szFilename);
+}
+
 C4Value C4AulExec::DirectExec(C4PropList *p, const char *szScript, const char *szContext, bool fPassErrors, C4AulScriptContext* context, bool parse_function)
 {
 	if (DEBUGREC_SCRIPT && Config.General.DebugRec)
@@ -23,6 +23,8 @@
 #include "script/C4Aul.h"
 #include "script/C4AulScriptFunc.h"
 
+#include <chrono>
+
 const int MAX_CONTEXT_STACK = 512;
 const int MAX_VALUE_STACK = 1024;
 
@@ -51,6 +53,53 @@ struct C4AulScriptContext
 	StdStrBuf ReturnDump(StdStrBuf Dump = StdStrBuf(""));
 };
 
+// records the time spent in every script call stack with nanosecond resolution
+class C4AulStackProfiler
+{
+private:
+	// node in the call tree
+	struct Node
+	{
+		size_t iParent;
+		StdCopyStrBuf Name;
+		uint64_t tTotal{0}; // including callees
+		uint64_t tCallees{0};
+	};
+	// call on the stack
+	struct Frame
+	{
+		size_t iNode;
+		uint64_t tStart;
+	};
+	// finished call for trace export
+	struct Call
+	{
+		size_t iNode;
+		uint64_t tStart, tDuration;
+	};
+	static const size_t MaxCalls = 500000;
+
+	std::chrono::steady_clock::time_point tStart;
+	std::vector<Node> Nodes; // Nodes[0] is the root
+	std::map<std::pair<size_t, C4AulScriptFunc *>, size_t> Children;
+	std::vector<Frame> Stack;
+	std::vector<Call> Calls;
+	size_t iDroppedCalls{0};
+
+	uint64_t Now() const { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tStart).count(); }
+	StdStrBuf GetStackName(size_t iNode) const;
+	bool SaveCollapsedStacks(const char *szFilename) const;
+	bool SaveChromeTrace(const char *szFilename) const;
+public:
+	C4AulStackProfiler();
+
+	void Enter(C4AulScriptFunc *pFunc);
+	void Leave();
+	void Finish(); // close calls that are still on the stack
+	void Show() const; // log the stacks with the most self time
+	bool Save(const char *szFilename) const; // Chrome trace for *.json, collapsed stacks otherwise
+};
+
 class C4AulExec
 {
 
@@ -68,13 +117,14 @@ private:
 	C4TimeMilliseconds tDirectExecStart;
 	uint32_t tDirectExecTotal; // profiler time for DirectExec
 	C4ScriptHost *pProfiledScript;
+	std::unique_ptr<C4AulStackProfiler> StackProfiler;
 
 	C4AulScriptContext Contexts[MAX_CONTEXT_STACK];
 	C4Value Values[MAX_VALUE_STACK];
 
-	void StartProfiling(C4ScriptHost *pScript); // starts recording the times
+	void StartProfiling(C4ScriptHost *pScript, bool fRecordStacks); // starts recording the times
 	bool IsProfiling() { return fProfiling; }
-	void StopProfiling() { fProfiling=false; }
+	void StopProfiling() { fProfiling=false; StackProfiler.reset(); }
 	friend class C4AulProfiler;
 public:
 	C4Value Exec(C4AulScriptFunc *pSFunc, C4PropList * p, C4Value pPars[], bool fPassErrors);
@@ -191,8 +241,10 @@ private:
 	ALWAYS_INLINE void CheckOpPars(C4V_Type Type1, C4V_Type Type2, const char * opname)
 	{
 		// Get parameters
-		C4Value *pPar1 = pCurVal - 1, *pPar2 = pCurVal;
-
+		CheckOpPars(pCurVal - 1, pCurVal, Type1, Type2, opname);
+	}
+	ALWAYS_INLINE void CheckOpPars(C4Value *pPar1, C4Value *pPar2, C4V_Type Type1, C4V_Type Type2, const char * opname)
+	{
 		// Typecheck parameters
 		if (!pPar1->CheckParConversion(Type1))
 			throw C4AulExecError(FormatString(R"(operator "%s" left side got %s, but expected %s)",
@@ -255,8 +307,9 @@ private:
 	void Show();
 public:
 	static void Abort() { AulExec.StopProfiling(); }
-	static void StartProfiling(C4ScriptHost *pScript); // reset times and start collecting new ones
-	static void StopProfiling(); // stop the profiler and displays results
+	static void StartProfiling(C4ScriptHost *pScript, bool fRecordStacks = false); // reset times and start collecting new ones
+	static void StopProfiling(const char *szStackFilename = nullptr); // stop the profiler and displays results or saves call stacks
+	static bool IsRecordingStacks() { return AulExec.IsProfiling() && AulExec.StackProfiler; }
 };
 
 #endif // C4AULEXEC_H
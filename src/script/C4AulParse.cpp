@@ -576,6 +576,17 @@ static const char * GetTTName(C4AulBCCType e)
 	case AB_BitXOr: return "BitXOr";  // ^
 	case AB_BitOr: return "BitOr";  // |
 
+	case AB_DUP_Sum: return "DUP_Sum";  // +
+	case AB_DUP_Sub: return "DUP_Sub";  // -
+	case AB_DUP_Mul: return "DUP_Mul";  // *
+	case AB_CONDN_LessThan: return "CONDN_LessThan";  // <
+	case AB_CONDN_LessThanEqual: return "CONDN_LessThanEqual";  // <=
+	case AB_CONDN_GreaterThan: return "CONDN_GreaterThan";  // >
+	case AB_CONDN_GreaterThanEqual: return "CONDN_GreaterThanEqual";  // >=
+	case AB_CONDN_Equal: return "CONDN_Equal";  // ==
+	case AB_CONDN_NotEqual: return "CONDN_NotEqual";  // !=
+	case AB_THIS_PROP: return "THIS_PROP";
+
 	case AB_CALL: return "CALL";    // direct object call
 	case AB_CALLFS: return "CALLFS";  // failsafe direct call
 	case AB_STACK: return "STACK";    // push nulls / pop
@@ -618,6 +629,8 @@ void C4AulScriptFunc::DumpByteCode()
 			switch (bcc.bccType)
 			{
 			case AB_JUMP: case AB_JUMPAND: case AB_JUMPOR: case AB_JUMPNNIL: case AB_CONDN: case AB_COND:
+			case AB_CONDN_LessThan: case AB_CONDN_LessThanEqual: case AB_CONDN_GreaterThan:
+			case AB_CONDN_GreaterThanEqual: case AB_CONDN_Equal: case AB_CONDN_NotEqual:
 				labels[&bcc + bcc.Par.i] = ++labeln; break;
 			default: break;
 			}
@@ -634,7 +647,7 @@ void C4AulScriptFunc::DumpByteCode()
 				fprintf(stderr, "\t%s\n", bcc.Par.f->GetFullName().getData()); break;
 			case AB_ERR:
 				if (bcc.Par.s)
-			case AB_CALL: case AB_CALLFS: case AB_LOCALN: case AB_LOCALN_SET: case AB_PROP: case AB_PROP_SET:
+			case AB_CALL: case AB_CALLFS: case AB_LOCALN: case AB_LOCALN_SET: case AB_PROP: case AB_PROP_SET: case AB_THIS_PROP:
 				fprintf(stderr, "\t%s\n", bcc.Par.s->GetCStr()); break;
 			case AB_STRING:
 			{
@@ -681,6 +694,8 @@ void C4AulScriptFunc::DumpByteCode()
 			case AB_CPROPLIST:
 				fprintf(stderr, "\t%s\n", C4VPropList(bcc.Par.p).GetDataString().getData()); break;
 			case AB_JUMP: case AB_JUMPAND: case AB_JUMPOR: case AB_JUMPNNIL: case AB_CONDN: case AB_COND:
+			case AB_CONDN_LessThan: case AB_CONDN_LessThanEqual: case AB_CONDN_GreaterThan:
+			case AB_CONDN_GreaterThanEqual: case AB_CONDN_Equal: case AB_CONDN_NotEqual:
 				fprintf(stderr, "\t% -d\n", labels[&bcc + bcc.Par.i]); break;
 			default:
 				fprintf(stderr, "\t% -d\n", bcc.Par.i); break;
@@ -720,7 +735,7 @@ bool C4ScriptHost::Preparse()
 	IncludesResolved = false;
 
 	// Parse will write the properties back after the ones from included scripts
-	GetPropList()->Properties.Swap(&LocalValues);
+	GetPropList()->GetDictionary().Swap(&LocalValues);
 
 	// return success
 	this->State = ASS_PREPARSED;
@@ -1727,7 +1742,7 @@ void C4ScriptHost::CopyPropList(C4Set<C4Property> & from, C4PropListStatic * to)
 					if (!p || p->GetParent() != to)
 					{
 						p = C4PropList::NewStatic(nullptr, to, prop->Key);
-						CopyPropList(prop->Value._getPropList()->Properties, p);
+						CopyPropList(prop->Value._getPropList()->GetDictionary(), p);
 					}
 				to->SetPropertyByS(prop->Key, C4VPropList(p));
 			}
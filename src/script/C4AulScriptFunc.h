@@ -67,6 +67,18 @@ enum C4AulBCCType : int
 	AB_BitXOr,  // ^
 	AB_BitOr, // |
 
+// superinstructions, only produced by the peephole optimizer in C4AulCompiler
+	AB_DUP_Sum, // + with the right side duplicated from stack
+	AB_DUP_Sub, // -
+	AB_DUP_Mul, // *
+	AB_CONDN_LessThan, // < and conditional jump (negated, pops both operands)
+	AB_CONDN_LessThanEqual, // <=
+	AB_CONDN_GreaterThan, // >
+	AB_CONDN_GreaterThanEqual, // >=
+	AB_CONDN_Equal, // ==
+	AB_CONDN_NotEqual, // !=
+	AB_THIS_PROP, // proplist access on this with static key
+
 	AB_CALL,    // direct object call
 	AB_CALLFS,  // failsafe direct call
 	AB_STACK,   // push nulls / pop
@@ -97,6 +109,7 @@ class C4AulBCC
 {
 public:
 	C4AulBCCType bccType{AB_EOFN}; // chunk type
+	int32_t CallCache{-1}; // index of the inline cache of AB_CALL/AB_CALLFS in the function; assigned on first execution
 	union
 	{
 		intptr_t X;
@@ -116,11 +129,12 @@ public:
 	{
 		DecRef();
 		bccType = from.bccType;
+		CallCache = -1;
 		Par = from.Par;
 		IncRef();
 		return *this;
 	}
-	C4AulBCC(C4AulBCC && from): bccType(from.bccType), Par(from.Par)
+	C4AulBCC(C4AulBCC && from): bccType(from.bccType), CallCache(from.CallCache), Par(from.Par)
 	{
 		from.bccType = AB_EOFN;
 	}
@@ -128,6 +142,7 @@ public:
 	{
 		DecRef();
 		bccType = from.bccType;
+		CallCache = from.CallCache;
 		Par = from.Par;
 		from.bccType = AB_EOFN;
 		return *this;
@@ -143,7 +158,7 @@ private:
 		{
 		case AB_ERR:
 			if (Par.s)
-		case AB_STRING: case AB_CALL: case AB_CALLFS: case AB_LOCALN: case AB_LOCALN_SET: case AB_PROP: case AB_PROP_SET:
+		case AB_STRING: case AB_CALL: case AB_CALLFS: case AB_LOCALN: case AB_LOCALN_SET: case AB_PROP: case AB_PROP_SET: case AB_THIS_PROP:
 			Par.s->IncRef();
 			break;
 		case AB_CARRAY:
@@ -158,7 +173,7 @@ private:
 		{
 		case AB_ERR:
 			if (Par.s)
-		case AB_STRING: case AB_CALL: case AB_CALLFS: case AB_LOCALN: case AB_LOCALN_SET: case AB_PROP: case AB_PROP_SET:
+		case AB_STRING: case AB_CALL: case AB_CALLFS: case AB_LOCALN: case AB_LOCALN_SET: case AB_PROP: case AB_PROP_SET: case AB_THIS_PROP:
 			Par.s->DecRef();
 			break;
 		case AB_CARRAY:
@@ -169,6 +184,17 @@ private:
 	}
 };
 
+// inline cache of a call site, remembering which function a name resolved to
+// for the first frozen proplist in the prototype chain of the call target
+struct C4AulCallCache
+{
+	static const int Size = 2;
+	uint32_t Epoch{0}; // C4PropList::GetFrozenEpoch() when the entries were added
+	const C4PropList *Holder[Size]{};
+	C4AulFunc *Func[Size]{};
+	int Next{0};
+};
+
 // script function class
 class C4AulScriptFunc : public C4AulFunc
 {
@@ -186,6 +212,7 @@ protected:
 	void DumpByteCode();
 	std::vector<C4AulBCC> Code;
 	std::vector<const char *> PosForCode;
+	std::vector<C4AulCallCache> CallCaches;
 	int ParCount;
 	C4V_Type ParType[C4AUL_MAX_Par]; // parameter types
 
@@ -218,6 +245,15 @@ public:
 
 	int GetLineOfCode(C4AulBCC * bcc);
 	C4AulBCC * GetCode();
+	C4AulCallCache & GetCallCache(C4AulBCC * bcc)
+	{
+		if (bcc->CallCache < 0)
+		{
+			bcc->CallCache = CallCaches.size();
+			CallCaches.emplace_back();
+		}
+		return CallCaches[bcc->CallCache];
+	}
 
 	uint32_t tProfileTime; // internally set by profiler
 
@@ -298,11 +298,15 @@ void C4Effect::Execute(C4Effect **ppEffectList)
 {
 	// advance all effect timers first; then do execution
 	// this prevents a possible endless loop if timers register into the same effect list with interval 1 while it is being executed
+	// most frames, no timer is due and nothing is to be removed: skip the second pass then
+	bool fAnyWork = false;
 	for (C4Effect *pEffect = *ppEffectList; pEffect; pEffect = pEffect->pNext)
 	{
 		// ignore dead status; adjusting their time doesn't hurt
 		++pEffect->iTime;
+		fAnyWork = fAnyWork || pEffect->IsDead() || pEffect->IsTimerDue();
 	}
+	if (!fAnyWork) return;
 	// get effect list
 	// execute all effects not marked as dead
 	C4Effect *pEffect = *ppEffectList, **ppPrevEffect=ppEffectList;
@@ -321,7 +325,7 @@ void C4Effect::Execute(C4Effect **ppEffectList)
 		else
 		{
 			// check timer execution
-			if (pEffect->iInterval && !(pEffect->iTime % pEffect->iInterval) && pEffect->iTime)
+			if (pEffect->IsTimerDue())
 			{
 				if (pEffect->CallTimer(pEffect->iTime) == C4Fx_Execute_Kill)
 				{
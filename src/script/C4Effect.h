@@ -111,6 +111,7 @@ public:
 	void FlipActive() { iPriority*=-1; } // alters activation status
 	bool IsActive() { return iPriority>0; } // returns whether effect is active
 	bool IsInactiveAndNotDead() { return iPriority<0; } // as the name says
+	bool IsTimerDue() { return iInterval && iTime && !(iTime % iInterval); } // returns whether the timer is to be called this frame
 
 	C4Effect *Get(const char *szName, int32_t iIndex=0, int32_t iMaxPriority=0);  // get effect by name
 	int32_t GetCount(const char *szMask, int32_t iMaxPriority=0); // count effects that match the mask
@@ -21,6 +21,7 @@
 #include "control/C4Record.h"
 #include "object/C4GameObjects.h"
 #include "script/C4Aul.h"
+#include "script/C4AulScriptFunc.h"
 
 void C4PropList::AddRef(C4Value *pRef)
 {
@@ -33,29 +34,25 @@ void C4PropList::AddRef(C4Value *pRef)
 	}
 #endif
 	pRef->NextRef = FirstRef;
+	pRef->PrevRef = nullptr;
+	if (FirstRef) FirstRef->PrevRef = pRef;
 	FirstRef = pRef;
 }
 
-void C4PropList::DelRef(const C4Value * pRef, C4Value * pNextRef)
+void C4PropList::DelRef(const C4Value * pRef, C4Value * pNextRef, C4Value * pPrevRef)
 {
 	assert(FirstRef);
 	// References to objects never have HasBaseArray set
-	if (pRef == FirstRef)
+	if (pNextRef) pNextRef->PrevRef = pPrevRef;
+	if (pPrevRef)
 	{
-		FirstRef = pNextRef;
-		if (pNextRef) return;
-	}
-	else
-	{
-		C4Value *pPrev = FirstRef;
-		while (pPrev->NextRef != pRef)
-		{
-			pPrev = pPrev->NextRef;
-			assert(pPrev);
-		}
-		pPrev->NextRef = pNextRef;
+		assert(pPrevRef->NextRef == pRef);
+		pPrevRef->NextRef = pNextRef;
 		return;
 	}
+	assert(pRef == FirstRef);
+	FirstRef = pNextRef;
+	if (pNextRef) return;
 	// Only pure script proplists are garbage collected here, host proplists
 	// like definitions and effects have their own memory management.
 	if (Delete()) delete this;
@@ -273,7 +270,7 @@ const char *C4PropListStatic::GetName() const
 }
 
 C4PropList::C4PropList(C4PropList * prototype):
-		prototype(prototype)
+		Shape(C4PropListShape::GetRoot()), prototype(prototype)
 {
 #ifdef _DEBUG
 	PropLists.Add(this);
@@ -309,7 +306,7 @@ C4PropListStatic *C4PropList::FreezeAndMakeStaticRecursively(std::vector<C4Value
 	{
 		// Make self static by creating a copy and replacing all references
 		this_static = NewStatic(GetPrototype(), parent, key);
-		this_static->Properties.Swap(&Properties); // grab properties
+		this_static->SwapOwnProperties(*this); // grab properties
 		this_static->Status = Status;
 		C4Value holder = C4VPropList(this);
 		while (FirstRef && FirstRef->NextRef)
@@ -349,12 +346,10 @@ C4PropListStatic *C4PropList::FreezeAndMakeStaticRecursively(std::vector<C4Value
 
 void C4PropList::Denumerate(C4ValueNumbers * numbers)
 {
-	const C4Property * p = Properties.First();
-	while (p)
+	ForEachOwnProperty([numbers](C4String *, const C4Value & v)
 	{
-		const_cast<C4Value &>(p->Value).Denumerate(numbers);
-		p = Properties.Next(p);
-	}
+		const_cast<C4Value &>(v).Denumerate(numbers);
+	});
 	prototype.Denumerate(numbers);
 	RemoveCyclicPrototypes();
 }
@@ -367,13 +362,15 @@ C4PropList::~C4PropList()
 		FirstRef->Data = nullptr; FirstRef->Type = C4V_Nil;
 		C4Value *ref = FirstRef;
 		FirstRef = FirstRef->NextRef;
-		ref->NextRef = nullptr;
+		ref->NextRef = ref->PrevRef = nullptr;
 	}
 #ifdef _DEBUG
 	assert(PropLists.Has(this));
 	PropLists.Remove(this);
 #endif
 	assert(!C4PropListNumbered::CheckPropList(this));
+	// Cached lookups might refer to this address
+	if (constant) ++FrozenEpoch;
 }
 
 bool C4PropList::operator==(const C4PropList &b) const
@@ -381,17 +378,15 @@ bool C4PropList::operator==(const C4PropList &b) const
 	// every numbered proplist has a unique number and is only identical to itself
 	if (this == &b) return true;
 	if (IsNumbered() || b.IsNumbered()) return false;
-	if (Properties.GetSize() != b.Properties.GetSize()) return false;
+	if (GetOwnPropertyCount() != b.GetOwnPropertyCount()) return false;
 	if (GetDef() != b.GetDef()) return false;
-	const C4Property * p = Properties.First();
-	while (p)
+	bool equal = true;
+	ForEachOwnProperty([&b, &equal](C4String * k, const C4Value & v)
 	{
-		const C4Property & bp = b.Properties.Get(p->Key);
-		if (!bp) return false;
-		if (p->Value != bp.Value) return false;
-		p = Properties.Next(p);
-	}
-	return true;
+		const C4Value * bv = equal ? b.FindOwnProperty(k) : nullptr;
+		if (!bv || v != *bv) equal = false;
+	});
+	return equal;
 }
 
 void C4PropList::CompileFunc(StdCompiler *pComp, C4ValueNumbers * numbers)
@@ -416,13 +411,61 @@ void C4PropList::CompileFunc(StdCompiler *pComp, C4ValueNumbers * numbers)
 	else
 		pComp->Value(mkParAdapt(prototype, numbers));
 	pComp->Separator(StdCompiler::SEP_SEP2);
-	pComp->Value(mkParAdapt(Properties, numbers));
+	// Same format as C4Set<C4Property>::CompileFunc, but keeps the order of shaped properties
+	bool fNaming = pComp->hasNaming();
+	if (pComp->isDeserializer())
+	{
+		ClearOwnProperties();
+		uint32_t iSize;
+		if (!fNaming) pComp->Value(iSize);
+		do
+		{
+			if (!fNaming && !iSize--)
+				break;
+			try
+			{
+				C4Property e;
+				pComp->Value(mkParAdapt(e, numbers));
+				C4Value * v = FindOwnProperty(e.Key);
+				if (v)
+					*v = e.Value;
+				else
+					AddOwnProperty(e.Key, e.Value);
+			}
+			catch (StdCompiler::NotFoundException *pEx)
+			{
+				delete pEx;
+				break;
+			}
+		}
+		while (pComp->Separator(StdCompiler::SEP_SEP));
+	}
+	else if (Shape)
+	{
+		if (!fNaming)
+		{
+			int32_t iSize = Shape->GetSize();
+			pComp->Value(iSize);
+		}
+		for (int32_t i = 0; i < Shape->GetSize(); ++i)
+		{
+			if (i) pComp->Separator(StdCompiler::SEP_SEP);
+			// the values themselves are compiled because C4ValueNumbers remembers their address
+			StdStrBuf key = Shape->GetKey(i)->GetData();
+			pComp->Value(key);
+			pComp->Separator(StdCompiler::SEP_SET);
+			pComp->Value(mkParAdapt(ShapeValues[i], numbers));
+		}
+	}
+	else
+		pComp->Value(mkParAdapt(*Properties, numbers));
 	if (oldFormat)
 	{
-		if (Properties.Has(&::Strings.P[P_Prototype]))
+		const C4Value * v = FindOwnProperty(&::Strings.P[P_Prototype]);
+		if (v)
 		{
-			prototype = Properties.Get(&::Strings.P[P_Prototype]).Value;
-			Properties.Remove(&::Strings.P[P_Prototype]);
+			prototype = *v;
+			RemoveOwnProperty(&::Strings.P[P_Prototype]);
 		}
 	}
 }
@@ -518,7 +561,7 @@ void C4Property::CompileFunc(StdCompiler *pComp, C4ValueNumbers * numbers)
 void C4PropList::AppendDataString(StdStrBuf * out, const char * delim, int depth, bool ignore_reference_parent) const
 {
 	StdStrBuf & DataString = *out;
-	if (depth <= 0 && Properties.GetSize())
+	if (depth <= 0 && GetOwnPropertyCount())
 	{
 		DataString.Append("...");
 		return;
@@ -532,20 +575,19 @@ void C4PropList::AppendDataString(StdStrBuf * out, const char * delim, int depth
 		has_elements = true;
 	}
 	// Append other properties
-	std::list<const C4Property *> sorted_props = Properties.GetSortedListOfElementPointers();
-	for (std::list<const C4Property *>::const_iterator p = sorted_props.begin(); p != sorted_props.end(); ++p)
+	for (const auto & p : GetSortedOwnProperties())
 	{
 		if (has_elements) DataString.Append(delim);
-		DataString.Append((*p)->Key->GetData());
+		DataString.Append(p.first->GetData());
 		DataString.Append(" = ");
-		DataString.Append((*p)->Value.GetDataString(depth - 1, ignore_reference_parent ? IsStatic() : nullptr));
+		DataString.Append(p.second->GetDataString(depth - 1, ignore_reference_parent ? IsStatic() : nullptr));
 		has_elements = true;
 	}
 }
 
 StdStrBuf C4PropList::ToJSON(int depth, bool ignore_reference_parent) const
 {
-	if (depth <= 0 && Properties.GetSize())
+	if (depth <= 0 && GetOwnPropertyCount())
 	{
 		throw new C4JSONSerializationError("maximum depth reached");
 	}
@@ -560,13 +602,12 @@ StdStrBuf C4PropList::ToJSON(int depth, bool ignore_reference_parent) const
 		has_elements = true;
 	}
 	// Append other properties
-	std::list<const C4Property *> sorted_props = Properties.GetSortedListOfElementPointers();
-	for (std::list<const C4Property *>::const_iterator p = sorted_props.begin(); p != sorted_props.end(); ++p)
+	for (const auto & p : GetSortedOwnProperties())
 	{
 		if (has_elements) DataString.Append(",");
-		DataString.Append(C4Value((*p)->Key).ToJSON());
+		DataString.Append(C4Value(p.first).ToJSON());
 		DataString.Append(":");
-		DataString.Append((*p)->Value.ToJSON(depth - 1, ignore_reference_parent ? IsStatic() : nullptr));
+		DataString.Append(p.second->ToJSON(depth - 1, ignore_reference_parent ? IsStatic() : nullptr));
 		has_elements = true;
 	}
 	DataString.Append("}");
@@ -576,11 +617,11 @@ StdStrBuf C4PropList::ToJSON(int depth, bool ignore_reference_parent) const
 std::vector< C4String * > C4PropList::GetSortedLocalProperties(bool add_prototype) const
 {
 	// return property list without descending into prototype
-	std::list<const C4Property *> sorted_props = Properties.GetSortedListOfElementPointers();
+	auto sorted_props = GetSortedOwnProperties();
 	std::vector< C4String * > result;
 	result.reserve(sorted_props.size() + add_prototype);
 	if (add_prototype) result.push_back(&::Strings.P[P_Prototype]); // implicit prototype for every prop list
-	for (auto p : sorted_props) result.push_back(p->Key);
+	for (const auto & p : sorted_props) result.push_back(p.first);
 	return result;
 }
 
@@ -589,20 +630,21 @@ std::vector< C4String * > C4PropList::GetSortedLocalProperties(const char *prefi
 	// return property list without descending into prototype
 	// ignore properties that have been overridden by proplist given in ignore_overridden or any of its prototypes up to and excluding this
 	std::vector< C4String * > result;
-	for (const C4Property *pp = Properties.First(); pp; pp = Properties.Next(pp))
-		if (pp->Key != &::Strings.P[P_Prototype])
-			if (!prefix || pp->Key->GetData().BeginsWith(prefix))
+	ForEachOwnProperty([&](C4String * key, const C4Value &)
+	{
+		if (key != &::Strings.P[P_Prototype])
+			if (!prefix || key->GetData().BeginsWith(prefix))
 			{
 				// Override check
 				const C4PropList *check = ignore_overridden;
-				bool overridden = false;
 				if (check && check != this)
 				{
-					if (check->HasProperty(pp->Key)) { overridden = true; break; }
+					if (check->HasProperty(key)) return;
 					check = check->GetPrototype();
 				}
-				result.push_back(pp->Key);
+				result.push_back(key);
 			}
+	});
 	// Sort
 	std::sort(result.begin(), result.end(), [](const C4String *a, const C4String *b) -> bool
 	{
@@ -619,10 +661,12 @@ std::vector< C4String * > C4PropList::GetUnsortedProperties(const char *prefix,
 	const C4PropList *p = this;
 	do
 	{
-		for (const C4Property *pp = p->Properties.First(); pp; pp = p->Properties.Next(pp))
-			if (pp->Key != &::Strings.P[P_Prototype])
-				if (!prefix || pp->Key->GetData().BeginsWith(prefix))
-					result.push_back(pp->Key);
+		p->ForEachOwnProperty([&](C4String * key, const C4Value &)
+		{
+			if (key != &::Strings.P[P_Prototype])
+				if (!prefix || key->GetData().BeginsWith(prefix))
+					result.push_back(key);
+		});
 		p = p->GetPrototype();
 		if (p == ignore_parent) break;
 	} while (p);
@@ -754,11 +798,213 @@ unsigned int C4Set<C4Property>::Hash<C4Property>(C4Property const & p)
 	return C4Set<C4Property>::Hash(p.Key);
 }
 
+C4PropListShape * C4PropListShape::GetRoot()
+{
+	// The root shape is referenced by itself and thus never deleted
+	static C4PropListShape * Root = []
+	{
+		C4PropListShape * r = new C4PropListShape;
+		r->IncRef();
+		return r;
+	}();
+	return Root;
+}
+
+C4PropListShape::~C4PropListShape()
+{
+	assert(Children.empty());
+	if (Parent)
+		Parent->Children.erase(Key.Get());
+}
+
+int32_t C4PropListShape::Find(const C4String * k) const
+{
+	if (Index.empty())
+	{
+		for (size_t i = 0; i < Keys.size(); ++i)
+			if (Keys[i] == k)
+				return i;
+		return -1;
+	}
+	unsigned int mask = Index.size() - 1;
+	for (unsigned int h = C4Set<C4Property>::Hash(k); ; ++h)
+	{
+		int32_t i = Index[h & mask];
+		if (i < 0 || Keys[i] == k)
+			return i;
+	}
+}
+
+C4RefCntPointer<C4PropListShape> C4PropListShape::GetChild(C4String * k)
+{
+	assert(Find(k) < 0 && GetSize() < MaxSize);
+	auto it = Children.find(k);
+	if (it != Children.end())
+		return it->second;
+	C4PropListShape * child = new C4PropListShape;
+	child->Parent = this;
+	child->Key = k;
+	child->Keys.reserve(Keys.size() + 1);
+	child->Keys = Keys;
+	child->Keys.push_back(k);
+	// Searching a few keys linearly is faster than hashing
+	if (child->Keys.size() > 8)
+	{
+		unsigned int capacity = 16;
+		while (capacity < child->Keys.size() * 2) capacity *= 2;
+		child->Index.assign(capacity, -1);
+		for (size_t i = 0; i < child->Keys.size(); ++i)
+		{
+			unsigned int h = C4Set<C4Property>::Hash(static_cast<const C4String *>(child->Keys[i]));
+			while (child->Index[h & (capacity - 1)] >= 0) ++h;
+			child->Index[h & (capacity - 1)] = i;
+		}
+	}
+	Children[k] = child;
+	return child;
+}
+
+C4RefCntPointer<C4PropListShape> C4PropListShape::GetWithout(int32_t i)
+{
+	assert(i >= 0 && i < GetSize());
+	if (i == GetSize() - 1)
+		return Parent;
+	C4RefCntPointer<C4PropListShape> r = GetRoot();
+	for (int32_t j = 0; j < GetSize(); ++j)
+		if (j != i)
+			r = r->GetChild(Keys[j]);
+	return r;
+}
+
+const C4Value * C4PropList::FindOwnProperty(const C4String * k) const
+{
+	if (Shape)
+	{
+		int32_t i = Shape->Find(k);
+		return i < 0 ? nullptr : &ShapeValues[i];
+	}
+	const C4Property & p = Properties->Get(k);
+	return p ? &p.Value : nullptr;
+}
+
+template<typename F> void C4PropList::ForEachOwnProperty(F f) const
+{
+	if (Shape)
+	{
+		for (int32_t i = 0; i < Shape->GetSize(); ++i)
+			f(Shape->GetKey(i), ShapeValues[i]);
+	}
+	else
+	{
+		for (const C4Property * p = Properties->First(); p; p = Properties->Next(p))
+			f(p->Key, p->Value);
+	}
+}
+
+std::vector<std::pair<C4String *, const C4Value *> > C4PropList::GetSortedOwnProperties() const
+{
+	std::vector<std::pair<C4String *, const C4Value *> > result;
+	result.reserve(GetOwnPropertyCount());
+	ForEachOwnProperty([&result](C4String * key, const C4Value & value)
+	{
+		result.emplace_back(key, &value);
+	});
+	std::sort(result.begin(), result.end(), [](const std::pair<C4String *, const C4Value *> & a, const std::pair<C4String *, const C4Value *> & b) -> bool
+	{
+		return strcmp(a.first->GetCStr(), b.first->GetCStr()) < 0;
+	});
+	return result;
+}
+
+void C4PropList::AddOwnProperty(C4String * k, const C4Value & to)
+{
+	assert(!FindOwnProperty(k));
+	if (Shape && Shape->GetSize() >= C4PropListShape::MaxSize)
+		GetDictionary();
+	if (Shape)
+	{
+		ShapeValues.push_back(to);
+		Shape = Shape->GetChild(k);
+	}
+	else
+		Properties->Add(C4Property(k, to));
+}
+
+void C4PropList::RemoveOwnProperty(C4String * k)
+{
+	if (Shape)
+	{
+		int32_t i = Shape->Find(k);
+		if (i < 0) return;
+		Shape = Shape->GetWithout(i);
+		ShapeValues.erase(ShapeValues.begin() + i);
+	}
+	else if (Properties->Has(k))
+	{
+		Properties->Remove(k);
+		ShrinkToShape();
+	}
+}
+
+void C4PropList::ClearOwnProperties()
+{
+	if (Shape)
+	{
+		Shape = C4PropListShape::GetRoot();
+		ShapeValues.clear();
+	}
+	else
+	{
+		Properties->Clear();
+		ShrinkToShape();
+	}
+}
+
+void C4PropList::SwapOwnProperties(C4PropList & other)
+{
+	std::swap(Shape, other.Shape);
+	ShapeValues.swap(other.ShapeValues);
+	Properties.swap(other.Properties);
+}
+
+C4Set<C4Property> & C4PropList::GetDictionary()
+{
+	if (Shape)
+	{
+		std::unique_ptr<C4Set<C4Property> > dictionary = std::make_unique<C4Set<C4Property> >();
+		for (int32_t i = 0; i < Shape->GetSize(); ++i)
+			dictionary->Add(C4Property(Shape->GetKey(i), ShapeValues[i]));
+		Properties = std::move(dictionary);
+		Shape = C4RefCntPointer<C4PropListShape>();
+		std::vector<C4Value>().swap(ShapeValues);
+	}
+	return *Properties;
+}
+
+void C4PropList::ShrinkToShape()
+{
+	// Non-static proplists only use a hash table while they have more than MaxSize
+	// properties. A loading client adds the properties in the saved order and thus
+	// ends up with the same storage and property order as the host.
+	if (Shape || IsStatic() || Properties->GetSize() > C4PropListShape::MaxSize) return;
+	C4RefCntPointer<C4PropListShape> shape(C4PropListShape::GetRoot());
+	std::vector<C4Value> values;
+	values.reserve(Properties->GetSize());
+	for (const C4Property * p = Properties->First(); p; p = Properties->Next(p))
+	{
+		shape = shape->GetChild(p->Key);
+		values.push_back(p->Value);
+	}
+	Properties.reset();
+	Shape = shape;
+	ShapeValues.swap(values);
+}
+
 bool C4PropList::GetPropertyByS(const C4String * k, C4Value *pResult) const
 {
-	if (Properties.Has(k))
+	if (const C4Value * v = FindOwnProperty(k))
 	{
-		*pResult = Properties.Get(k).Value;
+		*pResult = *v;
 		return true;
 	}
 	else if (k == &Strings.P[P_Prototype])
@@ -775,9 +1021,9 @@ bool C4PropList::GetPropertyByS(const C4String * k, C4Value *pResult) const
 C4String * C4PropList::GetPropertyStr(C4PropertyName n) const
 {
 	C4String * k = &Strings.P[n];
-	if (Properties.Has(k))
+	if (const C4Value * v = FindOwnProperty(k))
 	{
-		return Properties.Get(k).Value.getStr();
+		return v->getStr();
 	}
 	if (GetPrototype())
 	{
@@ -789,9 +1035,9 @@ C4String * C4PropList::GetPropertyStr(C4PropertyName n) const
 C4ValueArray * C4PropList::GetPropertyArray(C4PropertyName n) const
 {
 	C4String * k = &Strings.P[n];
-	if (Properties.Has(k))
+	if (const C4Value * v = FindOwnProperty(k))
 	{
-		return Properties.Get(k).Value.getArray();
+		return v->getArray();
 	}
 	if (GetPrototype())
 	{
@@ -803,9 +1049,9 @@ C4ValueArray * C4PropList::GetPropertyArray(C4PropertyName n) const
 C4AulFunc * C4PropList::GetFunc(C4String * k) const
 {
 	assert(k);
-	if (Properties.Has(k))
+	if (const C4Value * v = FindOwnProperty(k))
 	{
-		return Properties.Get(k).Value.getFunction();
+		return v->getFunction();
 	}
 	if (GetPrototype())
 	{
@@ -814,6 +1060,42 @@ C4AulFunc * C4PropList::GetFunc(C4String * k) const
 	return nullptr;
 }
 
+C4AulFunc * C4PropList::GetFunc(C4String * k, C4AulCallCache & cache) const
+{
+	assert(k);
+	// Proplists that are not frozen can change at any time, so search them directly
+	const C4PropList * p = this;
+	while (!p->IsFrozen())
+	{
+		if (const C4Value * v = p->FindOwnProperty(k))
+			return v->getFunction();
+		p = p->GetPrototype();
+		if (!p)
+			return nullptr;
+	}
+	// The remaining prototype chain can only change by thawing, which changes the epoch
+	if (cache.Epoch == FrozenEpoch)
+	{
+		for (int i = 0; i < C4AulCallCache::Size; ++i)
+			if (cache.Holder[i] == p)
+				return cache.Func[i];
+	}
+	else
+	{
+		cache = C4AulCallCache();
+		cache.Epoch = FrozenEpoch;
+	}
+	C4AulFunc * f = p->GetFunc(k);
+	// Frozen proplists can have prototypes which are not
+	for (const C4PropList * it = p->GetPrototype(); it; it = it->GetPrototype())
+		if (!it->IsFrozen())
+			return f;
+	cache.Holder[cache.Next] = p;
+	cache.Func[cache.Next] = f;
+	cache.Next = (cache.Next + 1) % C4AulCallCache::Size;
+	return f;
+}
+
 C4AulFunc * C4PropList::GetFunc(const char * s) const
 {
 	assert(s);
@@ -855,9 +1137,9 @@ C4Value C4PropList::Call(const char * s, C4AulParSet *Pars, bool fPassErrors)
 C4PropertyName C4PropList::GetPropertyP(C4PropertyName n) const
 {
 	C4String * k = &Strings.P[n];
-	if (Properties.Has(k))
+	if (const C4Value * p = FindOwnProperty(k))
 	{
-		C4String * v = Properties.Get(k).Value.getStr();
+		C4String * v = p->getStr();
 		if (v >= &Strings.P[0] && v < &Strings.P[P_LAST])
 			return C4PropertyName(v - &Strings.P[0]);
 		return P_LAST;
@@ -872,9 +1154,9 @@ C4PropertyName C4PropList::GetPropertyP(C4PropertyName n) const
 int32_t C4PropList::GetPropertyBool(C4PropertyName n, bool default_val) const
 {
 	C4String * k = &Strings.P[n];
-	if (Properties.Has(k))
+	if (const C4Value * v = FindOwnProperty(k))
 	{
-		return Properties.Get(k).Value.getBool();
+		return v->getBool();
 	}
 	if (GetPrototype())
 	{
@@ -886,9 +1168,9 @@ int32_t C4PropList::GetPropertyBool(C4PropertyName n, bool default_val) const
 int32_t C4PropList::GetPropertyInt(C4PropertyName n, int32_t default_val) const
 {
 	C4String * k = &Strings.P[n];
-	if (Properties.Has(k))
+	if (const C4Value * v = FindOwnProperty(k))
 	{
-		return Properties.Get(k).Value.getInt();
+		return v->getInt();
 	}
 	if (GetPrototype())
 	{
@@ -900,9 +1182,9 @@ int32_t C4PropList::GetPropertyInt(C4PropertyName n, int32_t default_val) const
 C4PropList *C4PropList::GetPropertyPropList(C4PropertyName n) const
 {
 	C4String * k = &Strings.P[n];
-	if (Properties.Has(k))
+	if (const C4Value * v = FindOwnProperty(k))
 	{
-		return Properties.Get(k).Value.getPropList();
+		return v->getPropList();
 	}
 	if (GetPrototype())
 	{
@@ -920,17 +1202,15 @@ C4ValueArray * C4PropList::GetProperties() const
 	{
 		a = GetPrototype()->GetProperties();
 		i = a->GetSize();
-		a->SetSize(i + Properties.GetSize());
+		a->SetSize(i + GetOwnPropertyCount());
 	}
 	else
 	{
-		a = new C4ValueArray(Properties.GetSize());
+		a = new C4ValueArray(GetOwnPropertyCount());
 		i = 0;
 	}
-	const C4Property * p = Properties.First();
-	while (p)
+	ForEachOwnProperty([&](C4String * newPropertyName, const C4Value &)
 	{
-		C4String *newPropertyName = p->Key;
 		assert(newPropertyName != nullptr && "Proplist key is nullpointer");
 		// Do we need to check for duplicate property names?
 		bool skipProperty = false;
@@ -948,8 +1228,7 @@ C4ValueArray * C4PropList::GetProperties() const
 			(*a)[i++] = C4VString(newPropertyName);
 			assert(((*a)[i - 1].GetType() == C4V_String) && "Proplist key is non-string");
 		}
-		p = Properties.Next(p);
-	}
+	});
 	// We might have added less properties than initially intended.
 	if (hasInheritedProperties)
 		a->SetSize(i);
@@ -958,12 +1237,19 @@ C4ValueArray * C4PropList::GetProperties() const
 
 C4String * C4PropList::EnumerateOwnFuncs(C4String * prev) const
 {
-	const C4Property * p = prev ? Properties.Next(&Properties.Get(prev)) : Properties.First();
+	if (Shape)
+	{
+		for (int32_t i = prev ? Shape->Find(prev) + 1 : 0; i < Shape->GetSize(); ++i)
+			if (ShapeValues[i].getFunction())
+				return Shape->GetKey(i);
+		return nullptr;
+	}
+	const C4Property * p = prev ? Properties->Next(&Properties->Get(prev)) : Properties->First();
 	while (p)
 	{
 		if (p->Value.getFunction())
 			return p->Key;
-		p = Properties.Next(p);
+		p = Properties->Next(p);
 	}
 	return nullptr;
 }
@@ -979,13 +1265,13 @@ void C4PropList::SetPropertyByS(C4String * k, const C4Value & to)
 				throw C4AulExecError("Trying to create cyclic prototype structure");
 		prototype.SetPropList(newpt);
 	}
-	else if (Properties.Has(k))
+	else if (C4Value * v = FindOwnProperty(k))
 	{
-		Properties.Get(k).Value = to;
+		*v = to;
 	}
 	else
 	{
-		Properties.Add(C4Property(k, to));
+		AddOwnProperty(k, to);
 	}
 }
 
@@ -994,7 +1280,7 @@ void C4PropList::ResetProperty(C4String * k)
 	if (k == &Strings.P[P_Prototype])
 		prototype.Set0();
 	else
-		Properties.Remove(k);
+		RemoveOwnProperty(k);
 }
 
 void C4PropList::Iterator::Init()
@@ -1007,20 +1293,18 @@ void C4PropList::Iterator::Reserve(size_t additionalAmount)
 	properties->reserve(properties->size() + additionalAmount);
 }
 
-void C4PropList::Iterator::AddProperty(const C4Property * prop)
+void C4PropList::Iterator::AddProperty(C4String * key, const C4Value & value)
 {
-	std::vector<const C4Property*>::size_type i = 0, len = properties->size();
-	for(;i < len; ++i)
+	for (C4Property & oldProperty : *properties)
 	{
-		const C4Property *oldProperty = (*properties)[i];
-		if (oldProperty->Key == prop->Key)
+		if (oldProperty.Key == key)
 		{
-			(*properties)[i] = prop;
+			oldProperty.Value = value;
 			return;
 		}
 	}
 	// not already in vector?
-	properties->push_back(prop);
+	properties->emplace_back(key, value);
 }
 
 C4PropList::Iterator C4PropList::begin()
@@ -1033,16 +1317,14 @@ C4PropList::Iterator C4PropList::begin()
 	}
 	else
 	{
-		iter.properties = std::make_shared<std::vector<const C4Property*> >();
+		iter.properties = std::make_shared<std::vector<C4Property> >();
 	}
-	iter.Reserve(Properties.GetSize());
+	iter.Reserve(GetOwnPropertyCount());
 
-	const C4Property * p = Properties.First();
-	while (p)
+	ForEachOwnProperty([&iter](C4String * key, const C4Value & value)
 	{
-		iter.AddProperty(p);
-		p = Properties.Next(p);
-	}
+		iter.AddProperty(key, value);
+	});
 
 	iter.Init();
 	return iter;
@@ -30,10 +30,12 @@
 All PropLists can be destroyed while there are still C4Values referencing them, though
 Definitions do not get destroyed during the game. So always check for nullpointers.
 
-The linked list formed by C4PropList::FirstRef and C4Value::NextRef is used to
-change all C4Values referencing the destroyed Proplist to contain nil instead.
+The doubly linked list formed by C4PropList::FirstRef and C4Value::NextRef/PrevRef
+is used to change all C4Values referencing the destroyed Proplist to contain nil instead.
 Objects are also cleaned up via various ClearPointer functions.
 The list is also used as a reference count to remove unused Proplists.
+Adding and removing a reference is O(1), so proplists referenced from many
+values (e.g. an object stored in large arrays) stay cheap to reference.
 The exception are C4PropListNumbered and C4Def, which have implicit references
 from C4GameObjects, C4Object and C4DefList. They have to be destroyed when loosing that reference.*/
 
@@ -64,11 +66,35 @@ inline bool C4Set<C4Property>::Equals(const C4Property &a, const C4Property &b)
 	return a.Key == b.Key;
 }
 
+// Key layout of a proplist. Proplists which got the same properties added in
+// the same order share a shape and only store their values, in shape order.
+class C4PropListShape: public C4RefCnt
+{
+public:
+	// proplists with more properties are stored as a hash table instead
+	static const int32_t MaxSize = 32;
+	static C4PropListShape * GetRoot(); // the shape without properties
+	~C4PropListShape() override;
+
+	int32_t GetSize() const { return Keys.size(); }
+	C4String * GetKey(int32_t i) const { return Keys[i]; }
+	int32_t Find(const C4String * k) const; // index of k or -1
+	C4RefCntPointer<C4PropListShape> GetChild(C4String * k); // this shape plus k at the end
+	C4RefCntPointer<C4PropListShape> GetWithout(int32_t i); // this shape minus the i-th key
+private:
+	C4PropListShape() = default;
+	C4RefCntPointer<C4PropListShape> Parent;
+	C4RefCntPointer<C4String> Key; // the last key, the others belong to the parent
+	std::vector<C4String *> Keys;
+	std::vector<int8_t> Index; // hash table of key indices, for larger shapes
+	std::map<const C4String *, C4PropListShape *> Children; // children remove themselves
+};
+
 class C4PropListNumbered;
 class C4PropList
 {
 public:
-	void Clear() { constant = false; Properties.Clear(); prototype.Set0(); }
+	void Clear() { Thaw(); ClearOwnProperties(); prototype.Set0(); }
 	virtual const char *GetName() const;
 	virtual void SetName (const char *NewName = nullptr);
 	virtual void SetOnFire(bool OnFire) { }
@@ -111,6 +137,7 @@ public:
 	{ return GetFunc(&Strings.P[k]); }
 	C4AulFunc * GetFunc(C4String * k) const;
 	C4AulFunc * GetFunc(const char * k) const;
+	C4AulFunc * GetFunc(C4String * k, C4AulCallCache & cache) const; // lookup through the inline cache of a call site
 	C4String * EnumerateOwnFuncs(C4String * prev = nullptr) const;
 	C4Value Call(C4PropertyName k, C4AulParSet *pPars=nullptr, bool fPassErrors=false)
 	{ return Call(&Strings.P[k], pPars, fPassErrors); }
@@ -120,7 +147,7 @@ public:
 	int32_t GetPropertyBool(C4PropertyName n, bool default_val = false) const;
 	int32_t GetPropertyInt(C4PropertyName k, int32_t default_val = 0) const;
 	C4PropList *GetPropertyPropList(C4PropertyName k) const;
-	bool HasProperty(C4String * k) const { return Properties.Has(k); }
+	bool HasProperty(C4String * k) const { return FindOwnProperty(k) != nullptr; }
 	// not allowed on frozen proplists
 	void SetProperty(C4PropertyName k, const C4Value & to)
 	{ SetPropertyByS(&Strings.P[k], to); }
@@ -131,9 +158,11 @@ public:
 	// only freeze proplists which are not going to be modified
 	// FIXME: Only C4PropListStatic get frozen. Optimize accordingly.
 	void Freeze() { constant = true; }
-	void Thaw() { constant = false; }
+	void Thaw() { if (constant) ++FrozenEpoch; constant = false; }
 	void ThawRecursively();
 	bool IsFrozen() const { return constant; }
+	// changes whenever a frozen proplist is thawed or destroyed, invalidating cached lookups
+	static uint32_t GetFrozenEpoch() { return FrozenEpoch; }
 
 	// Freeze this and all proplist in properties and ensure they are static proplists
 	// If a proplist is not static, replace it with a static proplist and replace all instances
@@ -159,14 +188,32 @@ public:
 protected:
 	C4PropList(C4PropList * prototype = nullptr);
 	void ClearRefs() { while (FirstRef) FirstRef->Set0(); }
+	C4Set<C4Property> & GetDictionary(); // switches to hash table storage
+	void ShrinkToShape(); // switches back to shape storage once there are few enough properties
 
 private:
 	void AddRef(C4Value *pRef);
-	void DelRef(const C4Value *pRef, C4Value * pNextRef);
+	void DelRef(const C4Value *pRef, C4Value * pNextRef, C4Value * pPrevRef);
 	C4Value *FirstRef{nullptr}; // No-Save
-	C4Set<C4Property> Properties;
+	// Own properties are either stored as values for the keys of a shape or, for
+	// proplists with more than C4PropListShape::MaxSize properties and static proplists
+	// created by the parser, in a hash table. Frozen proplists keep their shape when made static.
+	C4RefCntPointer<C4PropListShape> Shape;
+	std::vector<C4Value> ShapeValues;
+	std::unique_ptr<C4Set<C4Property> > Properties;
+	const C4Value * FindOwnProperty(const C4String * k) const;
+	C4Value * FindOwnProperty(const C4String * k)
+	{ return const_cast<C4Value *>(const_cast<const C4PropList *>(this)->FindOwnProperty(k)); }
+	int32_t GetOwnPropertyCount() const { return Shape ? Shape->GetSize() : Properties->GetSize(); }
+	template<typename F> void ForEachOwnProperty(F f) const; // f(C4String * key, const C4Value & value), in storage order
+	std::vector<std::pair<C4String *, const C4Value *> > GetSortedOwnProperties() const;
+	void AddOwnProperty(C4String * k, const C4Value & to);
+	void RemoveOwnProperty(C4String * k);
+	void ClearOwnProperties();
+	void SwapOwnProperties(C4PropList & other);
 	C4Value prototype;
 	bool constant{false}; // if true, this proplist is not changeable
+	static uint32_t FrozenEpoch;
 	friend class C4Value;
 	friend class C4ScriptHost;
 public:
@@ -175,19 +222,19 @@ public:
 	class Iterator
 	{
 	private:
-		std::shared_ptr<std::vector<const C4Property*> > properties;
-		std::vector<const C4Property*>::iterator iter;
+		std::shared_ptr<std::vector<C4Property> > properties;
+		std::vector<C4Property>::iterator iter;
 		// needed when constructing the iterator
 		// adds a property or overwrites existing property with same name
-		void AddProperty(const C4Property * prop);
+		void AddProperty(C4String * key, const C4Value & value);
 		void Reserve(size_t additionalAmount);
 		// Initializes internal iterator. Needs to be called before actually using the iterator.
 		void Init();
 	public:
 		Iterator() : properties(nullptr) { }
 
-		const C4Property * operator*() const { return *iter; }
-		const C4Property * operator->() const { return *iter; }
+		const C4Property * operator*() const { return &*iter; }
+		const C4Property * operator->() const { return &*iter; }
 		void operator++() { ++iter; };
 		void operator++(int) { operator++(); }
 
@@ -265,7 +312,7 @@ class C4PropListStatic: public C4PropList
 {
 public:
 	C4PropListStatic(C4PropList * prototype, const C4PropListStatic * parent, C4String * key):
-		C4PropList(prototype), Parent(parent), ParentKeyName(key) { }
+		C4PropList(prototype), Parent(parent), ParentKeyName(key) { GetDictionary(); }
 	~C4PropListStatic() override = default;
 	bool Delete() override { return true; }
 	C4PropListStatic * IsStatic() override { return this; }
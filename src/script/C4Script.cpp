@@ -965,7 +965,7 @@ static bool FnStartCallTrace(C4PropList * _this)
 	return true;
 }
 
-static bool FnStartScriptProfiler(C4PropList * _this, C4Def * pDef)
+static bool FnStartScriptProfiler(C4PropList * _this, C4Def * pDef, bool fRecordStacks)
 {
 	// get script to profile
 	C4ScriptHost *pScript;
@@ -974,7 +974,7 @@ static bool FnStartScriptProfiler(C4PropList * _this, C4Def * pDef)
 	else
 		pScript = nullptr;
 	// profile it
-	C4AulProfiler::StartProfiling(pScript);
+	C4AulProfiler::StartProfiling(pScript, fRecordStacks);
 	return true;
 }
 
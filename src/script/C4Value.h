@@ -106,7 +106,7 @@ public:
 
 	C4Value& operator = (const C4Value& nValue) { Set(nValue); return *this; }
 
-	~C4Value() { DelDataRef(Data, Type, NextRef); }
+	~C4Value() { DelDataRef(Data, Type, NextRef, PrevRef); }
 
 	// Checked getters
 	int32_t getInt() const { return CheckConversion(C4V_Int) ? Data.Int : 0; }
@@ -218,6 +218,7 @@ private:
 
 	// proplist reference list
 	C4Value * NextRef{nullptr};
+	C4Value * PrevRef{nullptr};
 
 	// data type
 	C4V_Type Type{C4V_Nil};
@@ -225,7 +226,7 @@ private:
 	void Set(C4V_Data nData, C4V_Type nType);
 
 	void AddDataRef();
-	void DelDataRef(C4V_Data Data, C4V_Type Type, C4Value *pNextRef);
+	void DelDataRef(C4V_Data Data, C4V_Type Type, C4Value *pNextRef, C4Value *pPrevRef);
 
 	bool FnCnvObject() const;
 	bool FnCnvDef() const;
@@ -300,14 +301,14 @@ ALWAYS_INLINE void C4Value::AddDataRef()
 	}
 }
 
-ALWAYS_INLINE void C4Value::DelDataRef(C4V_Data Data, C4V_Type Type, C4Value *pNextRef)
+ALWAYS_INLINE void C4Value::DelDataRef(C4V_Data Data, C4V_Type Type, C4Value *pNextRef, C4Value *pPrevRef)
 {
 	assert(Type < C4V_Any);
 	assert(Type != C4V_Nil || !Data);
 	// clean up
 	switch (Type)
 	{
-	case C4V_PropList: Data.PropList->DelRef(this, pNextRef); break;
+	case C4V_PropList: Data.PropList->DelRef(this, pNextRef, pPrevRef); break;
 	case C4V_String: Data.Str->DecRef(); break;
 	case C4V_Array: Data.Array->DecRef(); break;
 	case C4V_Function: Data.Fn->DecRef(); break;
@@ -323,6 +324,7 @@ ALWAYS_INLINE void C4Value::Set(C4V_Data nData, C4V_Type nType)
 	C4V_Data oData = Data;
 	C4V_Type oType = Type;
 	C4Value * oNextRef = NextRef;
+	C4Value * oPrevRef = PrevRef;
 
 	// change
 	Data = nData;
@@ -330,7 +332,7 @@ ALWAYS_INLINE void C4Value::Set(C4V_Data nData, C4V_Type nType)
 
 	// hold new data & clean up old
 	AddDataRef();
-	DelDataRef(oData, oType, oNextRef);
+	DelDataRef(oData, oType, oNextRef, oPrevRef);
 }
 
 ALWAYS_INLINE void C4Value::Set0()
@@ -343,7 +345,7 @@ ALWAYS_INLINE void C4Value::Set0()
 	Type = C4V_Nil;
 
 	// clean up (save even if Data was 0 before)
-	DelDataRef(oData, oType, NextRef);
+	DelDataRef(oData, oType, NextRef, PrevRef);
 }
 
 ALWAYS_INLINE C4Value::C4Value(C4Value && nValue) noexcept:
@@ -352,9 +354,9 @@ ALWAYS_INLINE C4Value::C4Value(C4Value && nValue) noexcept:
 	if (Type == C4V_PropList)
 	{
 		Data.PropList->AddRef(this);
-		Data.PropList->DelRef(&nValue, nValue.NextRef);
+		Data.PropList->DelRef(&nValue, nValue.NextRef, nValue.PrevRef);
 	}
-	nValue.Type = C4V_Nil; nValue.Data = nullptr; nValue.NextRef = nullptr;
+	nValue.Type = C4V_Nil; nValue.Data = nullptr; nValue.NextRef = nValue.PrevRef = nullptr;
 }
 
 #endif
@@ -33,6 +33,12 @@ struct internal_state {int dummy;}; /* for buggy compilers */
 #    define Z_BUFSIZE 16384
 #  endif
 #endif
+#ifndef Z_POINT_SPAN
+#  define Z_POINT_SPAN 1048576L /* uncompressed bytes between seek points */
+#endif
+#ifndef Z_POINT_MAX
+#  define Z_POINT_MAX 64 /* maximum number of seek points per file */
+#endif
 #ifndef Z_PRINTF_BUFSIZE
 #  define Z_PRINTF_BUFSIZE 4096
 #endif
@@ -62,6 +68,16 @@ static int gz_magic_new[2] = {0x1e, 0x8c};
 #define COMMENT      0x10 /* bit 4 set: file comment present */
 #define RESERVED     0xE0 /* bits 5..7: reserved */
 
+/* Saved inflate state, so that backward seeks do not have to restart
+ * decompression at the beginning of the file. */
+typedef struct gz_point {
+    z_stream stream;  /* copy of the inflate state */
+    z_off_t  pos;     /* file position of the next compressed byte */
+    z_off_t  in;      /* bytes into inflate */
+    z_off_t  out;     /* bytes out of inflate */
+    uLong    crc;     /* crc32 of the current member up to out */
+} gz_point;
+
 typedef struct gz_stream {
     z_stream stream;
     int      z_err;   /* error code for last stream operation */
@@ -79,6 +95,9 @@ typedef struct gz_stream {
     z_off_t  out;     /* bytes out of deflate or inflate */
     int      back;    /* one character push-back */
     int      last;    /* true if push-back is last character */
+    gz_point *points; /* seek points, sorted by out */
+    int      npoints; /* number of valid seek points */
+    z_off_t  next_point; /* out position for the next seek point */
 } gz_stream;
 
 
@@ -89,6 +108,9 @@ local void   check_header OF((gz_stream *s));
 local int    destroy      OF((gz_stream *s));
 local void   putLong      OF((FILE *file, uLong x));
 local uLong  getLong      OF((gz_stream *s));
+local void   add_point    OF((gz_stream *s));
+local int    restore_point OF((gz_stream *s, z_off_t offset));
+int ZEXPORT  c4_gzrewind  OF((gzFile file));
 
 /* ===========================================================================
      Opens a gzip (.gz) file for reading or writing. The mode parameter
@@ -132,6 +154,9 @@ local gzFile gz_open (path, mode, fd)
     s->crc = crc32(0L, Z_NULL, 0);
     s->msg = NULL;
     s->transparent = 0;
+    s->points = NULL;
+    s->npoints = 0;
+    s->next_point = Z_POINT_SPAN;
 
     s->path = (char*)ALLOC(strlen(path)+1);
     if (s->path == NULL) {
@@ -391,6 +416,8 @@ local int destroy (s)
     }
     if (s->z_err < 0) err = s->z_err;
 
+    while (s->npoints > 0) inflateEnd(&s->points[--s->npoints].stream);
+    TRYFREE(s->points);
     TRYFREE(s->inbuf);
     TRYFREE(s->outbuf);
     TRYFREE(s->path);
@@ -470,6 +497,12 @@ int ZEXPORT c4_gzread (file, buf, len)
             }
             s->stream.next_in = s->inbuf;
         }
+        if (s->out >= s->next_point && s->z_err == Z_OK) {
+            /* Bring the crc up to date before saving the state */
+            s->crc = crc32(s->crc, start, (uInt)(s->stream.next_out - start));
+            start = s->stream.next_out;
+            add_point(s);
+        }
         s->in += s->stream.avail_in;
         s->out += s->stream.avail_out;
         s->z_err = inflate(&(s->stream), Z_NO_FLUSH);
@@ -516,7 +549,7 @@ int ZEXPORT c4_gzgetc(file)
 {
     unsigned char c;
 
-    return gzread(file, &c, 1) == 1 ? c : -1;
+    return c4_gzread(file, &c, 1) == 1 ? c : -1;
 }
 
 
@@ -556,7 +589,7 @@ char * ZEXPORT c4_gzgets(file, buf, len)
     char *b = buf;
     if (buf == Z_NULL || len <= 0) return Z_NULL;
 
-    while (--len > 0 && gzread(file, buf, 1) == 1 && *buf++ != '\n') ;
+    while (--len > 0 && c4_gzread(file, buf, 1) == 1 && *buf++ != '\n') ;
     *buf = '\0';
     return b == buf && len > 0 ? Z_NULL : b;
 }
@@ -773,7 +806,9 @@ int ZEXPORT c4_gzflush (file, flush)
       gzseek returns the resulting offset location as measured in bytes from
    the beginning of the uncompressed stream, or -1 in case of error.
       SEEK_END is not implemented, returns error.
-      In this version of the library, gzseek can be extremely slow.
+      Backward seeks resume decompression from the closest seek point, which
+   are saved every Z_POINT_SPAN bytes while reading. Forward seeks still have
+   to decompress everything in between.
 */
 z_off_t ZEXPORT c4_gzseek (file, offset, whence)
     gzFile file;
@@ -833,12 +868,12 @@ z_off_t ZEXPORT c4_gzseek (file, offset, whence)
         return offset;
     }
 
-    /* For a negative seek, rewind and use positive seek */
-    if (offset >= s->out) {
-        offset -= s->out;
-    } else if (gzrewind(file) < 0) {
+    /* For a negative seek, go back to the closest seek point and use
+     * positive seek */
+    if (offset < s->out && restore_point(s, offset) < 0) {
         return -1L;
     }
+    offset -= s->out;
     /* offset is now the number of bytes to skip. */
 
     if (offset != 0 && s->outbuf == Z_NULL) {
@@ -855,13 +890,72 @@ z_off_t ZEXPORT c4_gzseek (file, offset, whence)
         int size = Z_BUFSIZE;
         if (offset < Z_BUFSIZE) size = (int)offset;
 
-        size = gzread(file, s->outbuf, (uInt)size);
+        size = c4_gzread(file, s->outbuf, (uInt)size);
         if (size <= 0) return -1L;
         offset -= size;
     }
     return s->out;
 }
 
+/* ===========================================================================
+     Saves the current inflate state as a seek point. Must only be called
+   between two calls to inflate, with the crc up to date.
+*/
+local void add_point (s)
+    gz_stream *s;
+{
+    gz_point *point;
+
+    s->next_point = s->out + Z_POINT_SPAN;
+    if (s->npoints >= Z_POINT_MAX) return;
+    if (s->points == NULL) {
+        s->points = (gz_point*)ALLOC(Z_POINT_MAX * sizeof(gz_point));
+        if (s->points == NULL) return;
+    }
+    point = &s->points[s->npoints];
+    if (inflateCopy(&point->stream, &s->stream) != Z_OK) return;
+    point->pos = ftell(s->file) - s->stream.avail_in;
+    point->in = s->in;
+    point->out = s->out;
+    point->crc = s->crc;
+    s->npoints++;
+}
+
+/* ===========================================================================
+     Continues decompression from the last seek point before offset, or
+   rewinds the file if there is none.
+*/
+local int restore_point (s, offset)
+    gz_stream *s;
+    z_off_t offset;
+{
+    gz_point *point;
+    int i = s->npoints;
+
+    while (i > 0 && s->points[i-1].out > offset) i--;
+    if (i == 0) return c4_gzrewind((gzFile)s);
+    point = &s->points[i-1];
+
+    inflateEnd(&s->stream);
+    if (inflateCopy(&s->stream, &point->stream) != Z_OK) {
+        /* out of memory: start over from the beginning */
+        if (inflateInit2(&s->stream, -MAX_WBITS) != Z_OK) {
+            s->z_err = Z_ERRNO;
+            return -1;
+        }
+        return c4_gzrewind((gzFile)s);
+    }
+    s->z_err = Z_OK;
+    s->z_eof = 0;
+    s->back = EOF;
+    s->stream.avail_in = 0;
+    s->stream.next_in = s->inbuf;
+    s->crc = point->crc;
+    s->in = point->in;
+    s->out = point->out;
+    return fseek(s->file, point->pos, SEEK_SET);
+}
+
 /* ===========================================================================
      Rewinds input file.
 */
@@ -892,7 +986,7 @@ int ZEXPORT c4_gzrewind (file)
 z_off_t ZEXPORT c4_gztell (file)
     gzFile file;
 {
-    return gzseek(file, 0L, SEEK_CUR);
+    return c4_gzseek(file, 0L, SEEK_CUR);
 }
 
 /* ===========================================================================
@@ -0,0 +1,149 @@
+/*
+ * OpenClonk, http://www.openclonk.org
+ *
+ * Copyright (c) 2016, The OpenClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+#include <C4Include.h>
+#include "object/C4CrossCheckTargets.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+	struct TestObject
+	{
+		int32_t x, y;
+		struct { int32_t x, y, Wdt, Hgt; } Shape;
+		int32_t Layer;
+		bool Collector, Target;
+		int32_t GetX() const { return x; }
+		int32_t GetY() const { return y; }
+	};
+
+	typedef std::vector<std::pair<size_t, size_t>> PairList;
+
+	// The pairing of CrossCheck without the sectors: For every collector in list order,
+	// all targets inside its shape in list order. Every pair fires a "callback" that
+	// moves the target away and might move another target into the shape of a later
+	// collector, like Collect or CatchBlow can.
+	PairList Pairing(std::vector<TestObject *> objects, C4CrossCheckTargets<TestObject> *targets)
+	{
+		PairList pairs;
+		auto is_target = [](TestObject *obj) { return obj->Target; };
+		if (targets) targets->Reset();
+		for (size_t i = 0; i < objects.size(); ++i)
+		{
+			TestObject *obj1 = objects[i];
+			if (!obj1->Collector) continue;
+			if (targets && targets->CanSkip(obj1, objects, is_target)) continue;
+			for (size_t j = 0; j < objects.size(); ++j)
+			{
+				TestObject *obj2 = objects[j];
+				if (obj2 != obj1 && obj2->Target &&
+				    Inside<int32_t>(obj2->x - (obj1->x + obj1->Shape.x), 0, obj1->Shape.Wdt - 1) &&
+				    Inside<int32_t>(obj2->y - (obj1->y + obj1->Shape.y), 0, obj1->Shape.Hgt - 1) &&
+				    obj1->Layer == obj2->Layer)
+				{
+					pairs.emplace_back(i, j);
+					if (targets) targets->Invalidate();
+					obj2->y += 1000;
+					TestObject *moved = objects[(i * 7 + j) % objects.size()];
+					if (moved->Target && i + 1 < objects.size())
+					{
+						moved->x = objects.back()->x;
+						moved->y = objects.back()->y;
+						moved->Layer = objects.back()->Layer;
+					}
+				}
+			}
+		}
+		return pairs;
+	}
+
+	// A fixed pseudo-random layout
+	std::vector<TestObject> Layout(size_t count, int32_t size)
+	{
+		std::vector<TestObject> objects(count);
+		uint32_t seed = 12345;
+		auto rnd = [&seed](int32_t max) { seed = seed * 1103515245 + 12345; return int32_t((seed >> 16) % max); };
+		for (TestObject &obj : objects)
+		{
+			obj.x = rnd(size);
+			obj.y = rnd(size);
+			obj.Shape = { -5, -10, 10, 20 };
+			obj.Layer = rnd(3) ? 0 : 1;
+			obj.Collector = !rnd(4);
+			obj.Target = !!rnd(3);
+		}
+		// The last object is a collector that gets all moved targets
+		objects.back().Collector = true;
+		objects.back().Target = false;
+		return objects;
+	}
+
+	PairList RunPairing(size_t count, int32_t size, bool broadphase)
+	{
+		std::vector<TestObject> objects = Layout(count, size);
+		std::vector<TestObject *> list;
+		for (TestObject &obj : objects) list.push_back(&obj);
+		C4CrossCheckTargets<TestObject> targets;
+		return Pairing(list, broadphase ? &targets : nullptr);
+	}
+}
+
+TEST(C4CrossCheckTargetsTest, SamePairsAsSectorWalk)
+{
+	// Sparse: Few pairs, most collectors are skipped
+	PairList sparse = RunPairing(300, 500, false);
+	EXPECT_FALSE(sparse.empty());
+	EXPECT_EQ(sparse, RunPairing(300, 500, true));
+	// Crowded: More pairs than target collections, so the broadphase gives up during the pass
+	PairList crowded = RunPairing(300, 100, false);
+	EXPECT_GT(crowded.size(), size_t(C4CrossCheckTargets<TestObject>::MaxCollections));
+	EXPECT_EQ(crowded, RunPairing(300, 100, true));
+}
+
+TEST(C4CrossCheckTargetsTest, Skip)
+{
+	TestObject collector = { 100, 100, { -5, -10, 10, 20 }, 0, true, false };
+	TestObject target = { 103, 95, { -5, -10, 10, 20 }, 0, false, true };
+	std::vector<TestObject *> objects = { &collector, &target };
+	auto is_target = [](TestObject *obj) { return obj->Target; };
+	C4CrossCheckTargets<TestObject> targets;
+	targets.Reset();
+	EXPECT_FALSE(targets.CanSkip(&collector, objects, is_target));
+	// Targets are not collected again until invalidated
+	target.Target = false;
+	EXPECT_FALSE(targets.CanSkip(&collector, objects, is_target));
+	targets.Invalidate();
+	EXPECT_TRUE(targets.CanSkip(&collector, objects, is_target));
+	// Other layer
+	target.Target = true; target.Layer = 1;
+	targets.Invalidate();
+	EXPECT_TRUE(targets.CanSkip(&collector, objects, is_target));
+	// Right and bottom borders of the shape are exclusive
+	target.Layer = 0; target.x = 105;
+	targets.Invalidate();
+	EXPECT_TRUE(targets.CanSkip(&collector, objects, is_target));
+	target.x = 95; target.y = 90;
+	targets.Invalidate();
+	EXPECT_FALSE(targets.CanSkip(&collector, objects, is_target));
+	target.y = 110;
+	targets.Invalidate();
+	EXPECT_TRUE(targets.CanSkip(&collector, objects, is_target));
+	// Never skips after too many collections
+	for (int32_t i = 0; i < C4CrossCheckTargets<TestObject>::MaxCollections; ++i)
+		targets.Invalidate(), targets.CanSkip(&collector, objects, is_target);
+	targets.Invalidate();
+	EXPECT_FALSE(targets.CanSkip(&collector, objects, is_target));
+}
@@ -0,0 +1,179 @@
+/*
+ * OpenClonk, http://www.openclonk.org
+ *
+ * Copyright (c) 2016, The OpenClonk Team and contributors
+ *
+ * Distributed under the terms of the ISC license; see accompanying file
+ * "COPYING" for details.
+ *
+ * "Clonk" is a registered trademark of Matthes Bender, used with permission.
+ * See accompanying file "TRADEMARK" for details.
+ *
+ * To redistribute this file separately, substitute the full license texts
+ * for the above references.
+ */
+
+#include <C4Include.h>
+#include "c4group/C4Group.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+	const long MB = 1024 * 1024; // distance of inflate seek points
+
+	// Compressible, but every 8-byte line is different, so reads from wrong positions show
+	StdBuf MakeData(size_t size)
+	{
+		StdBuf data;
+		data.New(size);
+		char *ptr = static_cast<char *>(data.getMData());
+		for (size_t i = 0; i < size; ++i)
+		{
+			size_t line = i / 8;
+			for (size_t digit = i % 8; digit < 6; ++digit) line /= 10;
+			ptr[i] = (i % 8 == 7) ? '\n' : '0' + line % 10;
+		}
+		return data;
+	}
+}
+
+class C4GroupSeekTest : public ::testing::Test
+{
+protected:
+	StdStrBuf GroupFile, ChildFile;
+	StdBuf Data, Small;
+
+	void SetUp() override
+	{
+		Data = MakeData(3 * MB + 123);
+		Small = MakeData(1000);
+		GroupFile.Copy("C4GroupSeekTest.tmp");
+		MakeTempFilename(&GroupFile);
+		// (Named like its entry, so the group does not resort it when adding)
+		ChildFile.Copy("C4GroupSeekTest.ocg");
+		// A packed child group in a packed group, both with the large entry
+		C4Group child;
+		ASSERT_TRUE(child.Open(ChildFile.getData(), true));
+		ASSERT_TRUE(child.Add("Data.bin", Data));
+		ASSERT_TRUE(child.Add("Small.txt", Small));
+		ASSERT_TRUE(child.Close());
+		C4Group grp;
+		ASSERT_TRUE(grp.Open(GroupFile.getData(), true));
+		ASSERT_TRUE(grp.Add("Data.bin", Data));
+		ASSERT_TRUE(grp.Add("Small.txt", Small));
+		ASSERT_TRUE(grp.Add(ChildFile.getData(), ChildFile.getData()));
+		ASSERT_TRUE(grp.Close());
+	}
+
+	void TearDown() override
+	{
+		EraseItem(GroupFile.getData());
+		EraseItem(ChildFile.getData());
+	}
+
+	// Reads size bytes and compares them to the expected data at pos
+	::testing::AssertionResult ReadsAt(CStdStream &stream, const StdBuf &expected, long pos, size_t size)
+	{
+		StdBuf buf;
+		buf.New(size);
+		if (!stream.Read(buf.getMData(), size))
+			return ::testing::AssertionFailure() << "read failed at " << pos;
+		if (memcmp(buf.getData(), expected.getPtr(pos), size))
+			return ::testing::AssertionFailure() << "wrong data at " << pos;
+		return ::testing::AssertionSuccess();
+	}
+
+	// Accesses and reads a group entry from pos on, so the group has to jump back
+	// when pos is before the position of the last read
+	::testing::AssertionResult EntryReadsAt(C4Group &grp, const char *entry, const StdBuf &expected, long pos, size_t size)
+	{
+		if (!grp.AccessEntry(entry))
+			return ::testing::AssertionFailure() << "no entry " << entry;
+		if (pos && !grp.Advance(pos))
+			return ::testing::AssertionFailure() << "advance to " << pos << " failed";
+		return ReadsAt(grp, expected, pos, size);
+	}
+};
+
+TEST_F(C4GroupSeekTest, SeekInCompressedFile)
+{
+	// The uncompressed group file, read straight through
+	CStdFile file;
+	ASSERT_TRUE(file.Open(GroupFile.getData(), true));
+	StdBuf whole;
+	whole.New(8 * MB);
+	size_t size = 0;
+	file.Read(whole.getMData(), whole.getSize(), &size);
+	ASSERT_GT(size, size_t(2 * Data.getSize()));
+	whole.SetSize(size);
+	ASSERT_TRUE(file.Close());
+	// The large entry is stored as is
+	const char *data_start = static_cast<const char *>(std::search(
+		static_cast<const char *>(whole.getData()), static_cast<const char *>(whole.getData()) + size,
+		static_cast<const char *>(Data.getData()), static_cast<const char *>(Data.getData()) + Data.getSize()));
+	EXPECT_NE(static_cast<const char *>(whole.getData()) + size, data_start);
+
+	// Seek around, across several seek points, forward and backward
+	ASSERT_TRUE(file.Open(GroupFile.getData(), true));
+	const long positions[] = {
+		0, MB / 2, 3 * MB + 10, MB + 17, // back across two seek points
+		MB - 1, 2 * MB, 2 * MB - 100, // back across one
+		5 * MB / 2, MB / 4, // back across all
+		4 * MB, 3 * MB, MB, 3 * MB + 1, 0, 2 * MB + 1 };
+	for (long pos : positions)
+	{
+		ASSERT_LE(pos + 4096, long(size));
+		ASSERT_EQ(0, file.Seek(pos, SEEK_SET)) << pos;
+		EXPECT_EQ(pos, file.Tell());
+		EXPECT_TRUE(ReadsAt(file, whole, pos, 4096));
+		EXPECT_EQ(pos + 4096, file.Tell());
+	}
+	// Relative seeks, within the read buffer and beyond
+	ASSERT_EQ(0, file.Seek(-100, SEEK_CUR));
+	EXPECT_EQ(2 * MB + 1 + 4096 - 100, file.Tell());
+	EXPECT_TRUE(ReadsAt(file, whole, 2 * MB + 1 + 4096 - 100, 100));
+	ASSERT_EQ(0, file.Seek(-long(MB), SEEK_CUR));
+	EXPECT_EQ(MB + 1 + 4096, file.Tell());
+	EXPECT_TRUE(ReadsAt(file, whole, MB + 1 + 4096, 100));
+	// The exact end: Nothing more to read
+	ASSERT_EQ(0, file.Seek(size, SEEK_SET));
+	EXPECT_EQ(long(size), file.Tell());
+	char c;
+	EXPECT_FALSE(file.Read(&c, 1));
+	// And back from there
+	ASSERT_EQ(0, file.Seek(size - 4096, SEEK_SET));
+	EXPECT_EQ(long(size - 4096), file.Tell());
+	EXPECT_TRUE(ReadsAt(file, whole, size - 4096, 4096));
+	EXPECT_EQ(long(size), file.Tell());
+	ASSERT_EQ(0, file.Seek(MB / 2, SEEK_SET));
+	EXPECT_TRUE(ReadsAt(file, whole, MB / 2, 4096));
+	file.Close();
+}
+
+TEST_F(C4GroupSeekTest, SeekInPackedGroup)
+{
+	C4Group grp;
+	ASSERT_TRUE(grp.Open(GroupFile.getData()));
+	// Forward and backward in the entry and across entries
+	EXPECT_TRUE(EntryReadsAt(grp, "Data.bin", Data, 5 * MB / 2, 4096));
+	EXPECT_TRUE(EntryReadsAt(grp, "Data.bin", Data, MB + 5, 4096));
+	EXPECT_TRUE(EntryReadsAt(grp, "Small.txt", Small, 0, Small.getSize()));
+	EXPECT_TRUE(EntryReadsAt(grp, "Data.bin", Data, 3 * MB, 123));
+	EXPECT_TRUE(EntryReadsAt(grp, "Data.bin", Data, 0, 4096));
+	EXPECT_TRUE(EntryReadsAt(grp, "Small.txt", Small, 500, 500));
+	EXPECT_TRUE(EntryReadsAt(grp, "Data.bin", Data, 2 * MB - 1, 2));
+	// Up to the exact end of the entry and back
+	EXPECT_TRUE(EntryReadsAt(grp, "Data.bin", Data, Data.getSize() - 10, 10));
+	EXPECT_TRUE(EntryReadsAt(grp, "Data.bin", Data, MB / 2, 4096));
+	// Child group in the packed group, which moves its mother
+	C4Group child;
+	ASSERT_TRUE(child.OpenAsChild(&grp, ChildFile.getData()));
+	EXPECT_TRUE(EntryReadsAt(child, "Data.bin", Data, 5 * MB / 2, 4096));
+	EXPECT_TRUE(EntryReadsAt(child, "Data.bin", Data, MB + 5, 4096));
+	EXPECT_TRUE(EntryReadsAt(child, "Small.txt", Small, 0, Small.getSize()));
+	EXPECT_TRUE(EntryReadsAt(child, "Data.bin", Data, 3 * MB, 123));
+	EXPECT_TRUE(EntryReadsAt(child, "Data.bin", Data, MB - 1, 2));
+	EXPECT_TRUE(child.Close());
+	EXPECT_TRUE(grp.Close());
+}
@@ -90,3 +90,98 @@ TEST(C4ValueTest, ToJSON)
 		EXPECT_EQ(C4Value(array).ToJSON(), R"#([{"Options":123}])#");
 	}
 }
+
+namespace
+{
+	// Counts how often its last reference went away
+	class RefTestPropList : public C4PropList
+	{
+	public:
+		int Released = 0;
+		bool Delete() override { ++Released; return false; }
+	};
+}
+
+TEST(C4ValueTest, PropListRefsInAnyOrder)
+{
+	// References are released at the head, in the middle and at the tail of the list
+	std::vector<int> order = { 0, 1, 2, 3 };
+	do
+	{
+		RefTestPropList p;
+		std::vector<C4Value> refs(order.size());
+		for (C4Value &ref : refs)
+			ref.SetPropList(&p);
+		for (size_t i = 0; i < order.size(); ++i)
+		{
+			EXPECT_EQ(0, p.Released);
+			refs[order[i]].Set0();
+		}
+		EXPECT_EQ(1, p.Released);
+		// The list is empty, so it works again from the start
+		refs[0].SetPropList(&p);
+		refs[0] = C4VInt(1);
+		EXPECT_EQ(2, p.Released);
+	}
+	while (std::next_permutation(order.begin(), order.end()));
+}
+
+TEST(C4ValueTest, PropListRefsSameData)
+{
+	RefTestPropList p;
+	C4Value a = C4VPropList(&p), b = C4VPropList(&p), c = C4VPropList(&p);
+	// Self-assignment and setting the same proplist again keep one reference each
+	a = a;
+	b.SetPropList(&p);
+	c.Set(a);
+	EXPECT_EQ(&p, a.getPropList());
+	EXPECT_EQ(&p, b.getPropList());
+	EXPECT_EQ(&p, c.getPropList());
+	b.Set0();
+	a.Set0();
+	EXPECT_EQ(0, p.Released);
+	c.Set0();
+	EXPECT_EQ(1, p.Released);
+}
+
+TEST(C4ValueTest, PropListRefsMoved)
+{
+	RefTestPropList p;
+	{
+		C4Value head = C4VPropList(&p), middle = C4VPropList(&p), tail = C4VPropList(&p);
+		C4Value moved(std::move(middle));
+		EXPECT_EQ(C4V_Nil, middle.GetType());
+		EXPECT_EQ(&p, moved.getPropList());
+		// A vector moves its values while it grows
+		std::vector<C4Value> values;
+		for (int i = 0; i < 100; ++i)
+			values.push_back(C4VPropList(&p));
+		values.erase(values.begin() + 10, values.begin() + 90);
+		values.clear();
+		head.Set0();
+		moved.Set0();
+		EXPECT_EQ(0, p.Released);
+	}
+	EXPECT_EQ(1, p.Released);
+}
+
+TEST(C4ValueTest, PropListDestroyedWhileReferenced)
+{
+	RefTestPropList other;
+	auto p = new RefTestPropList;
+	std::vector<C4Value> refs;
+	for (int i = 0; i < 5; ++i)
+		refs.push_back(C4VPropList(p));
+	refs[2].Set0();
+	delete p;
+	// All remaining references are nil now and no longer linked to anything
+	for (C4Value &ref : refs)
+	{
+		EXPECT_EQ(C4V_Nil, ref.GetType());
+		EXPECT_EQ(nullptr, ref.getPropList());
+	}
+	for (C4Value &ref : refs)
+		ref.SetPropList(&other);
+	refs.clear();
+	EXPECT_EQ(1, other.Released);
+}
@@ -285,3 +285,130 @@ TEST_F(AulTest, Conditionals)
 	EXPECT_EQ(C4VInt(1), RunCode("if (true) return 1; else return 2;"));
 	EXPECT_EQ(C4VInt(2), RunCode("if (false) return 1; else return 2;"));
 }
+
+TEST_F(AulTest, Superinstructions)
+{
+	// Arithmetic on two variables
+	EXPECT_EQ(C4VInt(7), RunCode("var a = 3, b = 4; return a + b;"));
+	EXPECT_EQ(C4VInt(-1), RunCode("var a = 3, b = 4; return a - b;"));
+	EXPECT_EQ(C4VInt(12), RunCode("var a = 3, b = 4; return a * b;"));
+	EXPECT_EQ(C4VInt(10), RunCode("var a = 3, b = 4; a += b + a; return a;"));
+	EXPECT_THROW(RunCode("var a = 3, b = \"x\"; return a + b;"), C4AulExecError);
+	EXPECT_THROW(RunCode("var a = 3, b = \"x\"; if (a < b) return 1;"), C4AulExecError);
+
+	// Comparison followed by a conditional jump
+	EXPECT_EQ(C4VInt(1), RunCode("var a = 3, b = 4; if (a < b) return 1; return 2;"));
+	EXPECT_EQ(C4VInt(2), RunCode("var a = 4, b = 4; if (a < b) return 1; return 2;"));
+	EXPECT_EQ(C4VInt(1), RunCode("var a = 4, b = 4; if (a <= b) return 1; return 2;"));
+	EXPECT_EQ(C4VInt(2), RunCode("var a = 4, b = 4; if (a > b) return 1; return 2;"));
+	EXPECT_EQ(C4VInt(1), RunCode("var a = 4, b = 4; if (a >= b) return 1; return 2;"));
+	EXPECT_EQ(C4VInt(1), RunCode("var a = [], b = a; if (a == b) return 1; return 2;"));
+	EXPECT_EQ(C4VInt(2), RunCode("var a = nil, b = 0; if (a != b) return 2; return 1;"));
+	EXPECT_EQ(C4VInt(45), RunCode("var s = 0; for (var i = 0; i < 10; ++i) s += i; return s;"));
+	EXPECT_EQ(C4VInt(0), RunCode("var i = 10; while (i > 0) i = i - 1; return i;"));
+
+	// Property access on this
+	EXPECT_EQ(C4VInt(42), RunScript("local i = 42; func Main() { return this.i; }"));
+	EXPECT_EQ(C4VInt(42), RunScript("local i; func Main() { this.i = 42; return i; }"));
+	EXPECT_EQ(C4VInt(43), RunScript("local i = 42; func Main() { this.i++; return this.i; }"));
+	EXPECT_EQ(C4VInt(42), RunScript("local i = 40; func Main() { return this.i += 2; }"));
+	// The property name is the jump target of the short-circuiting operator
+	EXPECT_EQ(C4VInt(7), RunScript("local x = 1; func Main() { var o = {x = 7}; return (o ?? this).x; }"));
+	EXPECT_EQ(C4VInt(7), RunScript("local x = 1; func Main() { var o = {x = 7}; return (o || this).x; }"));
+	EXPECT_EQ(C4VInt(1), RunScript("local x = 1; func Main() { var o = {x = 7}; return (o && this).x; }"));
+}
+
+TEST_F(AulTest, CallCache)
+{
+	// The same call site resolving to different functions
+	EXPECT_EQ(C4VArray(C4VInt(1), C4VInt(2), C4VInt(3), C4VInt(1), C4VInt(2), C4VInt(4)), RunScript(R"(
+static const A = { f = func() { return 1; } };
+static const B = { f = func() { return 2; } };
+static const C = { f = func() { return 3; } };
+static const D = new C { f = func() { return 4; } };
+func Main()
+{
+	var r = [], i = 0;
+	for (var p in [A, B, C, A, new B {}, new D {}])
+		r[i++] = p->f();
+	return r;
+}
+)"));
+	// Shadowing a function of a frozen prototype with a non-function property
+	EXPECT_EQ(C4VArray(C4VInt(1), C4VNull), RunScript(R"(
+static const A = { f = func() { return 1; } };
+func Main()
+{
+	var r = [], i = 0;
+	for (var p in [new A {}, new A { f = 5 }])
+		r[i++] = p->~f();
+	return r;
+}
+)"));
+}
+
+TEST_F(AulTest, PropListShapes)
+{
+	// Proplists with the same properties added in a different order
+	EXPECT_EQ(C4VBool(true), RunCode("var p = {}, q = {}; p.a = 1; p.b = 2; q.b = 2; q.a = 1; return DeepEqual(p, q);"));
+	EXPECT_EQ(C4VBool(false), RunCode("var p = {}, q = {}; p.a = 1; p.b = 2; q.a = 1; q.c = 2; return DeepEqual(p, q);"));
+	// Removing a property from the middle
+	EXPECT_EQ(C4VArray(C4VInt(1), C4VNull, C4VInt(3), C4VInt(4), C4VString("a"), C4VString("b"), C4VString("c")), RunCode(R"(
+var p = {};
+p.a = 1; p.b = 2; p.c = 3;
+ResetProperty("b", p);
+var r = [p.a, p.b, p.c];
+p.b = 4;
+var k = GetProperties(p);
+return [r[0], r[1], r[2], p.b, k[0], k[1], k[2]];
+)"));
+	// Proplists with more properties than fit into a shape
+	for (int n : { 5, 20, 40 })
+	{
+		EXPECT_EQ(C4VInt(n * (n - 1) / 2 - 3 + 100), RunCode(FormatString(R"(
+var p = {}, q = {};
+for (var i = 0; i < %d; ++i)
+{
+	p[Format("k%%d", i)] = i;
+	var j = %d - i - 1;
+	q[Format("k%%d", j)] = j;
+}
+if (!DeepEqual(p, q)) return -1;
+ResetProperty("k3", p);
+if (DeepEqual(p, q)) return -2;
+p.x = 100;
+var sum = 0;
+for (var k in GetProperties(p))
+	sum += p[k];
+return sum;
+)", n, n).getData()));
+	}
+}
+
+TEST_F(AulTest, PropListLoadOrder)
+{
+	// A proplist that shrank below the shape size after having more properties
+	C4Value host = RunCode(R"(
+var p = {};
+for (var i = 0; i < 40; ++i)
+	p[Format("k%d", i)] = i;
+for (var i = 0; i < 40; i += 4)
+	ResetProperty(Format("k%d", i), p);
+p.x = 100;
+return p;
+)");
+	ASSERT_TRUE(host.getPropList());
+	// Save and load it like a joining client would
+	C4ValueNumbers numbers;
+	StdBuf buf = DecompileToBuf<StdCompilerBinWrite>(mkParAdapt(*host.getPropList(), &numbers));
+	C4Value client = C4VPropList(C4PropList::New());
+	CompileFromBuf<StdCompilerBinRead>(mkParAdapt(*client.getPropList(), &numbers), buf);
+	EXPECT_EQ(C4Value(host.getPropList()->GetProperties()), C4Value(client.getPropList()->GetProperties()));
+	// Properties added after loading end up in the same place
+	for (C4Value p : { host, client })
+	{
+		p.getPropList()->SetPropertyByS(::Strings.RegString("y"), C4VInt(1));
+		p.getPropList()->ResetProperty(::Strings.RegString("k1"));
+	}
+	EXPECT_EQ(C4Value(host.getPropList()->GetProperties()), C4Value(client.getPropList()->GetProperties()));
+}
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+#
+# OpenClonk, http://www.openclonk.org
+#
+# Copyright (c) 2016, The OpenClonk Team and contributors
+#
+# Distributed under the terms of the ISC license; see accompanying file
+# "COPYING" for details.
+#
+# "Clonk" is a registered trademark of Matthes Bender, used with permission.
+# See accompanying file "TRADEMARK" for details.
+#
+# To redistribute this file separately, substitute the full license texts
+# for the above references.
+#
+# Records a scenario with a snapshot every frame, then plays the record back
+# with --seek and checks that playback starts at a snapshot before the frame
+# and stops seeking exactly at it. With a snapshot every frame, the record
+# also has more snapshots than C4Record keeps, so the thinned index is used.
+#
+# Usage: record_seek.py [-e ./openclonk-server] [-p ./planet]
+
+import argparse
+import glob
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+SCENARIO = "Tests.ocf/Minimal.ocs"
+SEEK_FRAME = 31
+
+
+# runs the engine until a log line matches done_re; returns all log lines
+def run(oc, planet, args, done_re, timeout=120):
+	process = subprocess.Popen([oc, "--language=US"] + args, cwd=planet,
+		stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+		universal_newlines=True)
+	lines = []
+	for line in process.stdout:
+		lines.append(line.rstrip("\n"))
+		if re.search(done_re, line):
+			break
+	# closing stdin shuts down the headless engine
+	process.stdin.close()
+	lines += [line.rstrip("\n") for line in process.stdout]
+	try:
+		process.wait(timeout)
+	except subprocess.TimeoutExpired:
+		process.kill()
+		sys.exit("Engine did not shut down")
+	return lines
+
+
+def fail(message, lines):
+	print("\n".join(lines))
+	sys.exit(message)
+
+
+def main():
+	parser = argparse.ArgumentParser(description="Test seeking in records")
+	parser.add_argument("-e", "--openclonk", default="./openclonk-server", help="Path to headless executable")
+	parser.add_argument("-p", "--planet", default="./planet", help="Path to planet directory containing game data")
+	options = parser.parse_args()
+	oc = os.path.abspath(options.openclonk)
+
+	with tempfile.TemporaryDirectory() as user_path:
+		config = os.path.join(user_path, "config")
+		with open(config, "w") as f:
+			f.write("[General]\nUserDataPath=\"%s\"\nRecordSnapshotInterval=1\n" % user_path)
+
+		# record until the game is over, as there are no players
+		lines = run(oc, options.planet, ["--config=" + config, "--record", SCENARIO], r"Game evaluated\.")
+		records = glob.glob(os.path.join(user_path, "Records.ocf", "*.ocs"))
+		if len(records) != 1:
+			fail("No record written", lines)
+
+		# seek in it
+		lines = run(oc, options.planet, ["--config=" + config, "--seek=%d" % SEEK_FRAME, records[0]],
+			r"Record: Seek reached frame|FATAL ERROR|Game cleared\.")
+		log = "\n".join(lines)
+		start = re.search(r"Record: Playback from snapshot at frame (\d+)", log)
+		if not start or not 0 < int(start.group(1)) <= SEEK_FRAME:
+			fail("Playback did not start from a snapshot", lines)
+		reached = re.search(r"Record: Seek reached frame (\d+)", log)
+		if not reached or int(reached.group(1)) != SEEK_FRAME:
+			fail("Seek did not reach frame %d" % SEEK_FRAME, lines)
+		print("Seek to frame %d from snapshot at frame %s" % (SEEK_FRAME, start.group(1)))
+
+
+if __name__ == "__main__":
+	main()